@@ -3,6 +3,9 @@ if (TARGET lunasvg)
 	# This is for when lunasvg is added via an add_subdirectory
 	get_target_property(LUNASVG_LIBRARY lunasvg LIBRARY_OUTPUT_NAME)
 	get_target_property(LUNASVG_INCLUDE_DIR lunasvg INCLUDE_DIRECTORIES)
+	if(NOT TARGET lunasvg::lunasvg)
+		add_library(lunasvg::lunasvg ALIAS lunasvg)
+	endif()
 else()
 	find_path(LUNASVG_INCLUDE_DIR lunasvg.h
 			HINTS $ENV{LUNASVG_DIR}
@@ -29,4 +32,14 @@ else()
 
 	set(LUNASVG_LIBRARIES ${LUNASVG_LIBRARY} )
 	set(LUNASVG_INCLUDE_DIRS ${LUNASVG_INCLUDE_DIR} )
+
+	# Provide the same target as lunasvg's own build, which is what RmlCore links to.
+	if(LUNASVG_FOUND AND NOT TARGET lunasvg::lunasvg)
+		add_library(lunasvg::lunasvg UNKNOWN IMPORTED)
+		set_target_properties(lunasvg::lunasvg PROPERTIES
+			IMPORTED_LOCATION "${LUNASVG_LIBRARY_RELEASE}"
+			IMPORTED_LOCATION_RELEASE "${LUNASVG_LIBRARY_RELEASE}"
+			IMPORTED_LOCATION_DEBUG "${LUNASVG_LIBRARY_DEBUG}"
+			INTERFACE_INCLUDE_DIRECTORIES "${LUNASVG_INCLUDE_DIR}")
+	endif()
 endif()
@@ -46,6 +46,7 @@
 #include "Core/DataVariable.h"
 #include "Core/Decorator.h"
 #include "Core/DecoratorInstancer.h"
+#include "Core/DrawList.h"
 #include "Core/Element.h"
 #include "Core/ElementDocument.h"
 #include "Core/ElementInstancer.h"
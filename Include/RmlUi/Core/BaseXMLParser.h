@@ -66,8 +66,18 @@ class RMLUICORE_API BaseXMLParser
 
 		/// Parses the given stream as an XML file, and calls the handlers when
 		/// interesting phenomena are encountered.
+		/// @note Streams in the compiled format, see Compile(), are replayed to the handlers without being parsed.
 		void Parse(Stream* stream);
 
+		/// Parses the given stream as an XML file, and writes the handler calls in a compiled binary format to the output
+		/// stream instead of calling the handlers. Parsing the compiled stream later calls the handlers in the same way as
+		/// the source would, without any tokenization. The registered CDATA tags and inner XML attributes are stored with
+		/// it, if these differ at the time of parsing then the embedded source is parsed instead.
+		/// @param[in] stream The stream to read the XML source from.
+		/// @param[out] output The stream to write the compiled result to.
+		/// @return True on success, false if the output could not be written. Compiled input is written unchanged.
+		bool Compile(Stream* stream, Stream* output);
+
 		/// Get the line number in the stream.
 		/// @return The line currently being processed in the XML stream.
 		int GetLineNumber() const;
@@ -85,10 +95,22 @@ class RMLUICORE_API BaseXMLParser
 		const URL* GetSourceURLPtr() const;
 
 	private:
+		class CompiledWriter;
+
 		const URL* source_url = nullptr;
 		String xml_source;
 		size_t xml_index = 0;
 
+		// Set while compiling, receives the handler calls in place of the handlers.
+		CompiledWriter* compiled_writer = nullptr;
+
+		void ReadSource(Stream* stream);
+		void ParseSource();
+
+		// Replays the compiled source to the handlers. Returns false if the source should be parsed instead, in which
+		// case the embedded source has replaced the compiled source.
+		bool ReplayCompiled();
+
 		void Next();
 		bool AtEnd() const;
 		char Look() const;
@@ -142,53 +142,49 @@ enum class FlexWrap : uint8_t { Nowrap, Wrap, WrapReverse };
 enum class JustifyContent : uint8_t { FlexStart, FlexEnd, Center, SpaceBetween, SpaceAround };
 
 
-/* 
-	A computed value is a value resolved as far as possible :before: introducing layouting. See CSS specs for details of each property.
-
-	Note: Enums and default values must correspond to the keywords and defaults in `StyleSheetSpecification.cpp`.
+/*
+	A group of computed values shared between elements by reference counting. Copying the group only copies a pointer,
+	and elements using the default values all share the same instance. The values are copied when first modified
+	through an instance that is shared.
 */
 
-struct ComputedValues
-{
-	Margin margin_top, margin_right, margin_bottom, margin_left;
-	Padding padding_top, padding_right, padding_bottom, padding_left;
-	float border_top_width = 0, border_right_width = 0, border_bottom_width = 0, border_left_width = 0;
-	Colourb border_top_color{ 255, 255, 255 }, border_right_color{ 255, 255, 255 }, border_bottom_color{ 255, 255, 255 }, border_left_color{ 255, 255, 255 };
-	float border_top_left_radius = 0, border_top_right_radius = 0, border_bottom_right_radius = 0, border_bottom_left_radius = 0;
-
-	Display display = Display::Inline;
-	Position position = Position::Static;
-
-	Top top{ Top::Auto };
-	Right right{ Right::Auto };
-	Bottom bottom{ Bottom::Auto };
-	Left left{ Left::Auto };
+template <typename T>
+class SharedValues {
+public:
+	SharedValues() : ptr(GetDefault()) {}
 
-	Float float_ = Float::None;
-	Clear clear = Clear::None;
+	const T& operator*() const { return *ptr; }
+	const T* operator->() const { return ptr.get(); }
 
-	BoxSizing box_sizing = BoxSizing::ContentBox;
+	/// Returns the values for modification, copying them first if they are shared with anyone else.
+	T& Write()
+	{
+		if (ptr.use_count() > 1)
+			ptr = MakeShared<T>(*ptr);
+		return *ptr;
+	}
 
-	ZIndex z_index = { ZIndex::Auto };
+	/// Returns true if the values are shared with the given group, without comparing the values themselves.
+	bool IsSharedWith(const SharedValues& other) const { return ptr == other.ptr; }
 
-	Width width = { Width::Auto };
-	MinWidth min_width;
-	MaxWidth max_width{ MaxWidth::Length, -1.f };
-	Height height = { Height::Auto };
-	MinHeight min_height;
-	MaxHeight max_height{ MaxHeight::Length, -1.f };
-
-	LineHeight line_height;
-	VerticalAlign vertical_align;
+private:
+	static const SharedPtr<T>& GetDefault()
+	{
+		static const SharedPtr<T> default_values = MakeShared<T>();
+		return default_values;
+	}
 
-	Overflow overflow_x = Overflow::Visible, overflow_y = Overflow::Visible;
-	Clip clip;
+	SharedPtr<T> ptr;
+};
 
-	Visibility visibility = Visibility::Visible;
+/*
+	Inherited computed values, mostly related to text. Elements share the group of their parent unless they set any
+	of these properties themselves.
+*/
 
-	Colourb background_color = Colourb(255, 255, 255, 0);
+struct InheritedValues
+{
 	Colourb color = Colourb(255, 255, 255);
-	Colourb image_color = Colourb(255, 255, 255);
 	float opacity = 1;
 
 	String font_family;
@@ -199,21 +195,36 @@ struct ComputedValues
 	// like most computed values, but placed here as it is used and inherited in a similar manner.
 	FontFaceHandle font_face_handle = 0;
 
+	LineHeight line_height;
+
 	TextAlign text_align = TextAlign::Left;
 	TextDecoration text_decoration = TextDecoration::None;
 	TextTransform text_transform = TextTransform::None;
 	WhiteSpace white_space = WhiteSpace::Normal;
 	WordBreak word_break = WordBreak::Normal;
 
-	LengthPercentage row_gap, column_gap;
-
 	String cursor;
 
+	Focus focus = Focus::Auto;
+	PointerEvents pointer_events = PointerEvents::Auto;
+
+	bool has_font_effect = false;
+};
+
+/*
+	Non-inherited computed values which are rarely set, such as transforms, animations and flexbox properties. Elements
+	not setting any of these properties all share the default group.
+*/
+
+struct RareValues
+{
+	Colourb image_color = Colourb(255, 255, 255);
+
+	LengthPercentage row_gap, column_gap;
+
 	Drag drag = Drag::None;
 	TabIndex tab_index = TabIndex::None;
-	Focus focus = Focus::Auto;
 	float scrollbar_margin = 0;
-	PointerEvents pointer_events = PointerEvents::Auto;
 
 	float perspective = 0;
 	PerspectiveOrigin perspective_origin_x = { PerspectiveOrigin::Percentage, 50.f };
@@ -227,9 +238,6 @@ struct ComputedValues
 	TransitionList transition;
 	AnimationList animation;
 
-	bool has_decorator = false;
-	bool has_font_effect = false;
-
 	AlignContent align_content = AlignContent::Stretch;
 	AlignItems align_items = AlignItems::Stretch;
 	AlignSelf align_self = AlignSelf::Auto;
@@ -241,6 +249,60 @@ struct ComputedValues
 	float flex_shrink = 1.f;
 };
 
+/* 
+	A computed value is a value resolved as far as possible :before: introducing layouting. See CSS specs for details of each property.
+
+	The box model and visual values used by most elements are stored directly in the computed values. Inherited and
+	rarely used values are stored in shared groups, read them through e.g. `values.inherited->font_size`.
+
+	Note: Enums and default values must correspond to the keywords and defaults in `StyleSheetSpecification.cpp`.
+*/
+
+struct ComputedValues
+{
+	Margin margin_top, margin_right, margin_bottom, margin_left;
+	Padding padding_top, padding_right, padding_bottom, padding_left;
+	float border_top_width = 0, border_right_width = 0, border_bottom_width = 0, border_left_width = 0;
+	Colourb border_top_color{ 255, 255, 255 }, border_right_color{ 255, 255, 255 }, border_bottom_color{ 255, 255, 255 }, border_left_color{ 255, 255, 255 };
+	float border_top_left_radius = 0, border_top_right_radius = 0, border_bottom_right_radius = 0, border_bottom_left_radius = 0;
+
+	Display display = Display::Inline;
+	Position position = Position::Static;
+
+	Top top{ Top::Auto };
+	Right right{ Right::Auto };
+	Bottom bottom{ Bottom::Auto };
+	Left left{ Left::Auto };
+
+	Float float_ = Float::None;
+	Clear clear = Clear::None;
+
+	BoxSizing box_sizing = BoxSizing::ContentBox;
+
+	ZIndex z_index = { ZIndex::Auto };
+
+	Width width = { Width::Auto };
+	MinWidth min_width;
+	MaxWidth max_width{ MaxWidth::Length, -1.f };
+	Height height = { Height::Auto };
+	MinHeight min_height;
+	MaxHeight max_height{ MaxHeight::Length, -1.f };
+
+	VerticalAlign vertical_align;
+
+	Overflow overflow_x = Overflow::Visible, overflow_y = Overflow::Visible;
+	Clip clip;
+
+	Visibility visibility = Visibility::Visible;
+
+	Colourb background_color = Colourb(255, 255, 255, 0);
+
+	bool has_decorator = false;
+
+	SharedValues<InheritedValues> inherited;
+	SharedValues<RareValues> rare;
+};
+
 } // namespace Style
 
 
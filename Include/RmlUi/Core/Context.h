@@ -40,11 +40,15 @@ namespace Rml {
 class Stream;
 class ContextInstancer;
 class ElementDocument;
+class ElementUtilities;
 class EventListener;
+class Geometry;
 class RenderInterface;
 class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
+class DrawListRecorder;
+class FrameArena;
 enum class EventId : uint16_t;
 
 /**
@@ -87,6 +91,39 @@ public:
 	/// Renders all visible elements in the context's documents.
 	bool Render();
 
+	/// Enables or disables draw-list rendering of this context.
+	/// When enabled, Context::Render() records all geometry together with its texture, transform and scissor state into a
+	/// single draw list, merging consecutive geometry which shares the same state. The draw list is then submitted in one
+	/// call to RenderInterface::RenderDrawList(), instead of the individual geometry, transform and scissor calls.
+	/// @note Geometry is not compiled in this mode. Any custom rendering which calls the render interface directly, instead of
+	/// through Rml::Geometry, is submitted out of order with the draw list.
+	/// @param[in] enable True to enable draw-list rendering, false to render each geometry individually.
+	void EnableDrawListRendering(bool enable);
+	/// Returns true if draw-list rendering is enabled for this context.
+	bool IsDrawListRenderingEnabled() const;
+	/// Enables or disables retained rendering of this context, enabling draw-list rendering if necessary.
+	/// When enabled, the geometry recorded for each element is kept between frames, and only elements which have changed
+	/// since the previous frame are rendered again, all other elements replay their previous geometry into the draw list.
+	/// If nothing at all has changed, the previous draw list is submitted again without traversing the documents.
+	/// @note Custom elements which change their rendered output other than through properties or layout must call
+	/// Element::DirtyRender() when that happens.
+	/// @param[in] enable True to enable retained rendering, false to record all elements on every frame.
+	void EnableRetainedRendering(bool enable);
+	/// Returns true if retained rendering is enabled for this context.
+	bool IsRetainedRenderingEnabled() const;
+
+	/// Enables or disables parallel updates of this context.
+	/// When enabled, Context::Update() updates the style of each document, and then formats its layout, on the worker
+	/// threads. Event dispatching, element and decorator instancing, and texture loading are forwarded to the thread
+	/// calling Update(), while data models are still updated on that thread before the documents.
+	/// @note The documents must be independent of each other. Custom elements and event listeners must not access other
+	/// documents during the update. Custom elements, any custom font engine, and the system interface's LogMessage() and
+	/// GetElapsedTime() must be safe to call from other threads.
+	/// @param[in] enable True to update the documents in parallel, false to update them one after the other.
+	void EnableParallelUpdate(bool enable);
+	/// Returns true if parallel updates are enabled for this context.
+	bool IsParallelUpdateEnabled() const;
+
 	/// Creates a new, empty document and places it into this context.
 	/// @param[in] instancer_name The name of the instancer used to create the document.
 	/// @return The new document, or nullptr if no document could be created.
@@ -338,6 +375,14 @@ private:
 	Vector2i clip_origin;
 	Vector2i clip_dimensions;
 
+	// Set when draw-list rendering is enabled.
+	UniquePtr<DrawListRecorder> draw_list_recorder;
+
+	bool parallel_update = false;
+
+	// Backs short-lived containers during update, render, and input processing; reset at the end of each call.
+	UniquePtr<FrameArena> frame_arena;
+
 	using DataModels = UnorderedMap<String, UniquePtr<DataModel>>;
 	DataModels data_models;
 
@@ -362,6 +407,9 @@ private:
 	// Returns the data model with the provided name, or nullptr if it does not exist.
 	DataModel* GetDataModelPtr(const String& name) const;
 
+	// Returns the draw list recorder while rendering in draw-list mode, otherwise nullptr.
+	DrawListRecorder* GetActiveDrawListRecorder() const;
+
 	// Builds the parameters for a generic key event.
 	void GenerateKeyEventParameters(Dictionary& parameters, Input::KeyIdentifier key_identifier);
 	// Builds the parameters for a generic mouse event.
@@ -371,6 +419,9 @@ private:
 	// Builds the parameters for a drag event.
 	void GenerateDragEventParameters(Dictionary& parameters);
 
+	// Updates and formats each document on the worker threads, used when parallel updates are enabled.
+	void UpdateDocumentsParallel();
+
 	// Releases all unloaded documents pending destruction.
 	void ReleaseUnloadedDocuments();
 
@@ -378,6 +429,8 @@ private:
 	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
 
 	friend class Rml::Element;
+	friend class Rml::ElementUtilities;
+	friend class Rml::Geometry;
 	friend RMLUICORE_API Context* CreateContext(const String&, Vector2i, RenderInterface*);
 };
 
@@ -72,6 +72,7 @@ public:
 	/// Runs the convolution filter. The filter will operate on each pixel in the destination
 	/// surface, setting its opacity to the result the filter on the source opacity values. The
 	/// colour values will remain unchanged.
+	/// Summing kernels which are separable, such as Gaussian kernels, are run as a horizontal and a vertical pass.
 	/// @param[in] destination The RGBA-encoded destination buffer.
 	/// @param[in] destination_dimensions The size of the destination region (in pixels).
 	/// @param[in] destination_stride The stride (in bytes) of the destination region.
@@ -91,6 +91,12 @@ RMLUICORE_API FileInterface* GetFileInterface();
 RMLUICORE_API void SetFontEngineInterface(FontEngineInterface* font_interface);
 /// Returns RmlUi's font interface.
 RMLUICORE_API FontEngineInterface* GetFontEngineInterface();
+
+/// Sets the number of worker threads used for background tasks and parallel document updates. This is not required to be
+/// called, but if it is it must be called before Initialise().
+/// @param[in] num_threads The number of worker threads, or a negative value to choose one based on the hardware. With zero
+///                        threads, all work is done on the thread calling into RmlUi.
+RMLUICORE_API void SetNumWorkerThreads(int num_threads);
 	
 /// Creates a new element context.
 /// @param[in] name The new name of the context. This must be unique.
@@ -49,6 +49,10 @@ public:
 	void DirtyVariable(const String& variable_name);
 	void DirtyAllVariables();
 
+	// Dirty a part of a variable by its address, such as 'items[42].health'. Only views which depend on the address, any part
+	// of it, or on any address it is a part of are updated. Views depending only on other members or indices are not.
+	void DirtyAddress(const String& address);
+
 	explicit operator bool() { return model; }
 
 private:
@@ -0,0 +1,86 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_DRAWLIST_H
+#define RMLUI_CORE_DRAWLIST_H
+
+#include "Header.h"
+#include "Types.h"
+#include "Vertex.h"
+
+namespace Rml {
+
+/**
+	A single batch of triangles in a draw list, sharing the same texture, transform and scissor state.
+ */
+
+struct RMLUICORE_API DrawCommand
+{
+	/// The texture to apply to the batch, or zero if untextured.
+	TextureHandle texture = 0;
+
+	/// The range of vertices in the draw list used by this batch.
+	int vertex_offset = 0;
+	int num_vertices = 0;
+	/// The range of indices in the draw list used by this batch. Indices are relative to the first vertex of the batch.
+	int index_offset = 0;
+	int num_indices = 0;
+
+	/// Index into the draw list's transforms, or -1 if no transform applies to the batch.
+	int transform_index = -1;
+
+	/// The scissor region to apply to the batch, only valid when scissoring is enabled.
+	bool scissor_enabled = false;
+	Vector2i scissor_origin;
+	Vector2i scissor_dimensions;
+};
+
+/**
+	A flat command buffer of all the geometry rendered by a context during a single call to Context::Render(). All geometry
+	translations are baked into the vertex positions, and consecutive geometry sharing the same render state is merged into
+	a single command.
+ */
+
+struct RMLUICORE_API DrawList
+{
+	Vector<Vertex> vertices;
+	Vector<int> indices;
+	Vector<Matrix4f> transforms;
+	Vector<DrawCommand> commands;
+
+	/// Clears the draw list while retaining the allocated memory.
+	void Clear()
+	{
+		vertices.clear();
+		indices.clear();
+		transforms.clear();
+		commands.clear();
+	}
+};
+
+} // namespace Rml
+#endif
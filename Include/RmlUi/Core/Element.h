@@ -44,6 +44,7 @@ namespace Rml {
 
 class Context;
 class DataModel;
+class DataViewFor;
 class Decorator;
 class ElementInstancer;
 class EventDispatcher;
@@ -53,6 +54,9 @@ class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
 class ElementStyle;
+class HitTestGrid;
+class LayoutCache;
+class LayoutDetails;
 class LayoutEngine;
 class LayoutInlineBox;
 class LayoutBlockBox;
@@ -63,7 +67,6 @@ class StyleSheet;
 class StyleSheetContainer;
 class TransformState;
 struct ElementMeta;
-struct StackingOrderedChild;
 
 /**
 	A generic element in the DOM tree.
@@ -170,6 +173,7 @@ public:
 	virtual bool GetIntrinsicDimensions(Vector2f& dimensions, float& ratio);
 
 	/// Checks if a given point in screen coordinates lies within the bordered area of this element.
+	/// @note When looking up the element under the mouse, only elements with a box containing the point are tested.
 	/// @param[in] point The point to test.
 	/// @return True if the element is within this element, false otherwise.
 	virtual bool IsPointWithinElement(Vector2f point);
@@ -570,6 +574,11 @@ public:
 	/// @return The element's context's render interface.
 	RenderInterface* GetRenderInterface();
 
+	/// Marks the element as needing to be rendered again, used by contexts with retained rendering enabled.
+	/// Elements which change their rendered output other than through properties, layout or their text, such as custom
+	/// elements generating their own geometry, must call this whenever their output changes.
+	void DirtyRender();
+
 	/// Sets the instancer to use for releasing this element.
 	/// @param[in] instancer Instancer to set on this element.
 	void SetInstancer(ElementInstancer* instancer);
@@ -657,15 +666,38 @@ private:
 
 	void BuildLocalStackingContext();
 	void BuildStackingContext(ElementList* stacking_context);
-	static void BuildStackingContextForTable(Vector<StackingOrderedChild>& ordered_children, Element* child);
 	void DirtyStackingContext();
 
+	/// Invalidates the hit test grids of the owning document, called whenever the boxes or offsets of an element change.
+	void DirtyHitTest();
+	/// Returns the hit test grid of this element's local stacking context, or nullptr if it should be tested linearly.
+	/// The stacking context must be up to date.
+	const HitTestGrid* GetHitTestGrid();
+
 	void DirtyStructure();
 	void UpdateStructure();
 
+	// Updates this element, but not its children.
+	void UpdateSelf(float dp_ratio, Vector2f vp_dimensions);
+
 	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
 	void UpdateTransformState();
 
+	void DirtyRenderRecursive();
+
+	/// Dirties the layout of the nearest layout boundary at or above the given element, or the whole document if there is none.
+	void DirtyLayoutFromBoundary(Element* element);
+
+	/// Returns the cache of intrinsic size measurements made during layout of this element.
+	LayoutCache& GetLayoutCache();
+
+	/// Returns a recently updated sibling whose computed values can be copied to this element, or nullptr if there is none.
+	const Element* FindStyleSharingSibling() const;
+
+	/// Moves the given children into the given order, placing them in the positions of the child list currently occupied by them.
+	/// Unlike removing and inserting the children again, they stay attached to the document and data model.
+	void ReorderChildren(const ElementList& ordered_children);
+
 	void OnDpRatioChangeRecursive();
 
 	/// Start an animation, replacing any existing animations of the same property name. If start_value is null, the element's current value is used.
@@ -688,6 +720,14 @@ private:
 	/// Advances the animations (including transitions) forward in time.
 	void AdvanceAnimations();
 
+	/// Applies an animated value of a property which only affects rendering, such as transform, opacity and colours,
+	/// directly to the computed values, bypassing style resolution.
+	/// @return False if the value can not be applied directly, and should be set as a regular property instead.
+	bool ApplyAnimatedProperty(PropertyId id, const Property& property);
+
+	/// Sets the computed value of the descendants inheriting the given property from this element, after it was changed by an animation.
+	void PropagateAnimatedValue(PropertyId id, const Property& property, const Style::SharedValues<Style::InheritedValues>& previous_values);
+
 	// Original tag this element came from.
 	String tag;
 
@@ -765,14 +805,20 @@ private:
 	bool dirty_animation;
 	bool dirty_transition;
 
+	// True if the element needs to be rendered again, instead of replaying its previously recorded geometry.
+	bool render_dirty;
+
 	ElementMeta* meta;
 
 	friend class Rml::Context;
+	friend class Rml::DataViewFor;
 	friend class Rml::ElementStyle;
+	friend class Rml::LayoutDetails;
 	friend class Rml::LayoutEngine;
 	friend class Rml::LayoutBlockBox;
 	friend class Rml::LayoutInlineBox;
 	friend class Rml::ElementScroll;
+	friend class Rml::HitTestGrid;
 };
 
 } // namespace Rml
@@ -160,6 +160,8 @@ private:
 	void DirtyLayout() override;
 	/// Returns true if the document has been marked as needing a re-layout.
 	bool IsLayoutDirty() override;
+	/// Marks a layout boundary within the document as needing a re-layout, see LayoutEngine::IsLayoutBoundary().
+	void DirtyLayoutBoundary(Element* element);
 
 	/// Notify the document that media query related properties have changed and that style sheets need to be re-evaluated.
 	void DirtyMediaQueries();
@@ -192,9 +194,13 @@ private:
 	// Is the layout dirty?
 	bool layout_dirty;
 
+	// Layout boundaries to be formatted on their own during the next layout update, unless the whole document is dirty.
+	Vector<ObserverPtr<Element>> dirty_layout_boundaries;
+
 	bool position_dirty;
 
 	friend class Rml::Context;
+	friend class Rml::Element;
 	friend class Rml::Factory;
 
 };
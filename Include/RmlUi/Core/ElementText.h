@@ -80,6 +80,7 @@ public:
 	void SuppressAutoLayout();
 
 protected:
+	void OnUpdate() override;
 	void OnRender() override;
 
 	void OnPropertyChange(const PropertyIdSet& properties) override;
@@ -115,6 +115,12 @@ public:
 	/// @param[in] document_base_tag The tag used to wrap the document, eg. 'rml'.
 	/// @return The instanced document, or nullptr if an error occurred.
 	static ElementPtr InstanceDocumentStream(Context* context, Stream* stream, const String& document_base_tag);
+	/// Compiles the RML of a document or element stream into a binary format, which is parsed without tokenization.
+	/// Compiled RML is detected wherever RML streams are instanced, such as in Context::LoadDocument().
+	/// @param[in] stream The stream to read the RML from.
+	/// @param[out] output The stream to write the compiled RML to.
+	/// @return True on success, false otherwise.
+	static bool CompileDocumentStream(Stream* stream, Stream* output);
 
 	/// Registers a non-owning pointer to an instancer that will be used to instance decorators.
 	/// @param[in] name The name of the decorator the instancer will be called for.
@@ -154,6 +160,18 @@ public:
 	static void ClearStyleSheetCache();
 	/// Clears the template cache. This will force template to be reloaded.
 	static void ClearTemplateCache();
+	/// Enables or disables the document cache, which is disabled by default. When enabled, documents loaded from files
+	/// with Context::LoadDocument() are read and parsed only once, later loads of the same path instance the document from
+	/// the cached parse. Inline style sheets are similarly parsed only once. Disabling the cache clears it.
+	/// @note Changes to cached files are not detected, call ClearDocumentCache() to reload them.
+	static void EnableDocumentCache(bool enable);
+	/// Loads a document into the document cache ahead of time, such as during startup, along with the templates and
+	/// style sheets referred to by its header.
+	/// @param[in] document_path The path of the document, as it will later be passed to Context::LoadDocument().
+	/// @return True if the document was cached, false if it could not be loaded or the document cache is disabled.
+	static bool PreloadDocument(const String& document_path);
+	/// Clears the document cache. This will force documents to be reloaded.
+	static void ClearDocumentCache();
 
 	/// Registers an instancer for all events.
 	/// @param[in] instancer The instancer to be called.
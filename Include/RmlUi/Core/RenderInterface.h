@@ -38,6 +38,7 @@
 namespace Rml {
 
 class Context;
+struct DrawList;
 
 /**
 	The abstract base class for application-specific rendering implementation. Your application must provide a concrete
@@ -80,6 +81,12 @@ public:
 	/// @param[in] geometry The application-specific compiled geometry to release.
 	virtual void ReleaseCompiledGeometry(CompiledGeometryHandle geometry);
 
+	/// Called by RmlUi when draw-list rendering is enabled on the context, see Context::EnableDrawListRendering(). Then, this
+	/// replaces all individual geometry, transform and scissor calls made while rendering the context.
+	/// The default implementation submits each command through RenderGeometry(), SetTransform() and the scissor functions.
+	/// @param[in] draw_list The recorded draw list, only valid during this call.
+	virtual void RenderDrawList(const DrawList& draw_list);
+
 	/// Called by RmlUi when it wants to enable or disable scissoring to clip content.
 	/// @param[in] enable True if scissoring is to enabled, false if it is to be disabled.
 	virtual void EnableScissorRegion(bool enable) = 0;
@@ -113,7 +120,7 @@ public:
 	virtual void SetTransform(const Matrix4f* transform);
 
 	/// Get the context currently being rendered. This is only valid during RenderGeometry,
-	/// CompileGeometry, RenderCompiledGeometry, EnableScissorRegion and SetScissorRegion.
+	/// CompileGeometry, RenderCompiledGeometry, RenderDrawList, EnableScissorRegion and SetScissorRegion.
 	Context* GetContext() const;
 
 private:
@@ -34,6 +34,7 @@
 namespace Rml {
 
 struct Spritesheet;
+class StyleSheetBinary;
 
 
 struct Rectangle {
@@ -91,6 +92,8 @@ private:
 
 	Spritesheets spritesheets;
 	SpriteMap sprite_map;
+
+	friend class Rml::StyleSheetBinary;
 };
 
 
@@ -41,6 +41,7 @@ class ElementDefinition;
 class StyleSheetNode;
 class Decorator;
 class SpritesheetList;
+class StyleSheetBinary;
 class StyleSheetContainer;
 class StyleSheetParser;
 struct PropertySource;
@@ -113,6 +114,7 @@ private:
 	using DecoratorCache = UnorderedMap<String, Vector<SharedPtr<const Decorator>>>;
 	mutable DecoratorCache decorator_cache;
 
+	friend Rml::StyleSheetBinary;
 	friend Rml::StyleSheetParser;
 	friend Rml::StyleSheetContainer;
 };
@@ -50,9 +50,14 @@ public:
 	StyleSheetContainer();
 	virtual ~StyleSheetContainer();
 
-	/// Loads a style from a CSS definition.
+	/// Loads a style from a CSS definition, or from a binary style sheet previously written by SaveStyleSheetContainer().
 	bool LoadStyleSheetContainer(Stream* stream, int begin_line_number = 1);
 
+	/// Writes the parsed style sheets in a binary format which can be loaded without parsing the RCSS again.
+	/// @note The binary format is tied to the version of the library, the style sheets should be compiled again when updating the library.
+	/// @return True on success, false if the style sheets contain values which cannot be stored in the binary format.
+	bool SaveStyleSheetContainer(Stream* stream) const;
+
 	/// Compiles a single style sheet by combining all contained style sheets whose media queries match the current state of the context.
 	/// @param[in] context The current context used for evaluating media query parameters against.
 	/// @returns True when the compiled style sheet was changed, otherwise false.
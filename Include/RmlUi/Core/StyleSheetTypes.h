@@ -88,7 +88,7 @@ struct StyleSheetIndex {
 	using NodeIndex = UnorderedMap<std::size_t, NodeList>;
 
 	// The following objects are given in prioritized order. Any nodes in the first object will not be contained in the next one and so on.
-	NodeIndex ids, classes, tags;
+	NodeIndex ids, classes, tags, pseudo_classes;
 	NodeList other;
 };
 } // namespace Rml
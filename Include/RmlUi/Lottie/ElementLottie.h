@@ -34,8 +34,6 @@
 #include "../Core/Geometry.h"
 #include "../Core/Texture.h"
 
-namespace rlottie { class Animation; }
-
 namespace Rml {
 
 class RMLUICORE_API ElementLottie : public Element
@@ -72,6 +70,9 @@ private:
 	// Update the texture for the next animation frame when necessary.
 	void UpdateTexture();
 
+	// Frames rendered ahead of time on the worker pool, shared with the worker tasks so that it outlives the element.
+	struct FrameQueue;
+
 	bool animation_dirty = false;
 	bool geometry_dirty = false;
 	bool texture_size_dirty = false;
@@ -91,8 +92,13 @@ private:
 	double time_animation_start = -1;
 	// The previous animation frame displayed.
 	size_t prev_animation_frame = size_t(-1);
+	// The dimensions of the frame currently in the texture.
+	Vector2i texture_dimensions;
+
+	// The pixel data of a prefetched frame, handed over to the texture when it is next loaded.
+	UniquePtr<const byte[]> prefetched_frame_data;
 
-	UniquePtr<rlottie::Animation> animation;
+	SharedPtr<FrameQueue> frame_queue;
 };
 
 } // namespace Rml
@@ -32,12 +32,14 @@
 #include "../Core/Header.h"
 #include "../Core/Element.h"
 #include "../Core/Geometry.h"
-#include "../Core/Texture.h"
-
-namespace lunasvg { class Document; }
 
 namespace Rml {
 
+namespace SVG {
+	struct SVGDocument;
+	struct SVGBitmap;
+}
+
 class RMLUICORE_API ElementSVG : public Element
 {
 public:
@@ -76,8 +78,8 @@ private:
 	bool geometry_dirty = false;
 	bool texture_size_dirty = false;
 
-	// The texture this element is rendering from.
-	Texture texture;
+	// The path of the SVG document, used as the key for the shared documents and bitmaps.
+	String source_path;
 
 	// The image's intrinsic dimensions.
 	Vector2f intrinsic_dimensions;
@@ -87,7 +89,11 @@ private:
 	// The geometry used to render this element.
 	Geometry geometry;
 
-	UniquePtr<lunasvg::Document> svg_document;
+	SharedPtr<SVG::SVGDocument> svg_document;
+
+	// The rasterised document this element is rendering from, and the bitmap replacing it once it has been rasterised.
+	SharedPtr<SVG::SVGBitmap> bitmap;
+	SharedPtr<SVG::SVGBitmap> pending_bitmap;
 };
 
 } // namespace Rml
@@ -0,0 +1,150 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "AncestorFilter.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Utilities.h"
+#include "ElementStyle.h"
+#include <algorithm>
+
+namespace Rml {
+
+// One filter per thread, as documents may be updated in parallel.
+static thread_local AncestorFilter ancestor_filter;
+
+uint32_t AncestorFilter::Hash(KeyType type, const String& name)
+{
+	size_t seed = (size_t)type;
+	Utilities::HashCombine(seed, name);
+	return uint32_t(uint64_t(seed) ^ (uint64_t(seed) >> 32));
+}
+
+void AncestorFilter::PushElement(const Element* element)
+{
+	AncestorFilter& filter = ancestor_filter;
+	const Element* parent = element->GetParentNode();
+
+	// When entering the hierarchy from somewhere else than the current element, such as when updating a single
+	// document, add all our ancestors first so that the filter is valid for our children.
+	if (parent && (filter.entries.empty() || filter.entries.back().element != parent))
+	{
+		const size_t first_implicit = filter.entries.size();
+		for (const Element* ancestor = parent; ancestor; ancestor = ancestor->GetParentNode())
+			filter.entries.push_back(Entry{ancestor, element, -1});
+		std::reverse(filter.entries.begin() + first_implicit, filter.entries.end());
+	}
+
+	filter.entries.push_back(Entry{element, nullptr, -1});
+}
+
+void AncestorFilter::PopElement(const Element* element)
+{
+	AncestorFilter& filter = ancestor_filter;
+	RMLUI_ASSERT(!filter.entries.empty() && filter.entries.back().element == element);
+
+	filter.PopEntry();
+
+	while (!filter.entries.empty() && filter.entries.back().implicit_owner == element)
+		filter.PopEntry();
+}
+
+const AncestorFilter* AncestorFilter::GetFilterForElement(const Element* element)
+{
+	AncestorFilter& filter = ancestor_filter;
+	const Element* parent = element->GetParentNode();
+	if (!parent || filter.entries.empty() || filter.entries.back().element != parent)
+		return nullptr;
+
+	filter.Populate();
+
+	return &filter;
+}
+
+bool AncestorFilter::MayContain(uint32_t hash) const
+{
+	return counters[hash & CounterMask] != 0 && counters[(hash >> NumBits) & CounterMask] != 0;
+}
+
+void AncestorFilter::Populate()
+{
+	for (; num_populated_entries < (int)entries.size(); num_populated_entries++)
+	{
+		Entry& entry = entries[num_populated_entries];
+		entry.hash_offset = (int)hashes.size();
+
+		const Element* element = entry.element;
+		hashes.push_back(Hash(KeyType::Tag, element->GetTagName()));
+
+		const String& id = element->GetId();
+		if (!id.empty())
+			hashes.push_back(Hash(KeyType::Id, id));
+
+		for (const String& class_name : element->GetStyle()->GetClassNameList())
+			hashes.push_back(Hash(KeyType::Class, class_name));
+
+		for (size_t i = (size_t)entry.hash_offset; i < hashes.size(); i++)
+			AddHash(hashes[i]);
+	}
+}
+
+void AncestorFilter::AddHash(uint32_t hash)
+{
+	uint8_t& counter_a = counters[hash & CounterMask];
+	uint8_t& counter_b = counters[(hash >> NumBits) & CounterMask];
+	if (counter_a != 255)
+		counter_a += 1;
+	if (counter_b != 255)
+		counter_b += 1;
+}
+
+void AncestorFilter::RemoveHash(uint32_t hash)
+{
+	uint8_t& counter_a = counters[hash & CounterMask];
+	uint8_t& counter_b = counters[(hash >> NumBits) & CounterMask];
+	if (counter_a != 255)
+		counter_a -= 1;
+	if (counter_b != 255)
+		counter_b -= 1;
+}
+
+void AncestorFilter::PopEntry()
+{
+	if ((int)entries.size() == num_populated_entries)
+	{
+		const int hash_offset = entries.back().hash_offset;
+		for (size_t i = (size_t)hash_offset; i < hashes.size(); i++)
+			RemoveHash(hashes[i]);
+
+		hashes.resize((size_t)hash_offset);
+		num_populated_entries -= 1;
+	}
+
+	entries.pop_back();
+}
+
+} // namespace Rml
@@ -0,0 +1,96 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ANCESTORFILTER_H
+#define RMLUI_CORE_ANCESTORFILTER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include <stdint.h>
+
+namespace Rml {
+
+class Element;
+
+/**
+	A counting bloom filter of the tag, id and class names of the ancestors of the element currently being updated.
+
+	Elements are pushed and popped during the update traversal, and the filter is only populated lazily once a style
+	definition actually needs to be resolved. This lets the style sheet reject nodes requiring ancestors which are
+	definitely not present in the element's hierarchy, without walking up the hierarchy for every node.
+ */
+
+class AncestorFilter {
+public:
+	enum class KeyType : uint8_t { Tag, Id, Class };
+
+	/// Returns the filter hash of a tag, id or class name.
+	static uint32_t Hash(KeyType type, const String& name);
+
+	/// Enters the element during the update traversal, its children will see it as an ancestor.
+	/// If the element's parent is not the currently entered element, all its ancestors are entered as well.
+	static void PushElement(const Element* element);
+	/// Leaves the element, must be paired with the previous call to PushElement().
+	static void PopElement(const Element* element);
+
+	/// Returns the filter containing all the ancestors of the given element, or nullptr if the element's ancestors are
+	/// not known to the filter.
+	static const AncestorFilter* GetFilterForElement(const Element* element);
+
+	/// Returns false if the hash is definitely not contained in the filter, true if it might be.
+	bool MayContain(uint32_t hash) const;
+
+private:
+	static constexpr int NumBits = 12;
+	static constexpr uint32_t NumCounters = 1u << NumBits;
+	static constexpr uint32_t CounterMask = NumCounters - 1;
+
+	struct Entry {
+		const Element* element;
+		// Set if the entry was implicitly pushed as an ancestor of the given element.
+		const Element* implicit_owner;
+		// The offset of the entry's hashes, only valid for entries which have been added to the counters.
+		int hash_offset;
+	};
+
+	// Adds the hashes of all pushed elements which are not yet in the counters.
+	void Populate();
+	void AddHash(uint32_t hash);
+	void RemoveHash(uint32_t hash);
+	void PopEntry();
+
+	Vector<Entry> entries;
+	Vector<uint32_t> hashes;
+	// The number of entries from the bottom of the stack whose hashes have been added to the counters.
+	int num_populated_entries = 0;
+
+	// Each hash sets two counters. Saturated counters are never decremented, only making the filter less precise.
+	uint8_t counters[NumCounters] = {};
+};
+
+} // namespace Rml
+#endif
@@ -29,11 +29,97 @@
 #include "../../Include/RmlUi/Core/BaseXMLParser.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/Stream.h"
+#include "BinaryFormat.h"
 #include "XMLParseTools.h"
+#include <algorithm>
+#include <stdint.h>
 #include <string.h>
 
 namespace Rml {
 
+// The signature at the start of every compiled XML source.
+static const char compiled_signature[BinaryWriter::signature_size] = { 'R', 'M', 'L', 'B', 'I', 'N', '\0', '\0' };
+
+// Must be bumped whenever the layout of the compiled format changes.
+static constexpr uint32_t compiled_version = 1;
+
+enum class CompiledNodeType : uint8_t { ElementStart, ElementEnd, Data };
+
+static bool IsCompiledSource(const String& source)
+{
+	return source.size() >= sizeof(compiled_signature) && memcmp(source.data(), compiled_signature, sizeof(compiled_signature)) == 0;
+}
+
+// The registrations are stored sorted so that they can be compared regardless of the set implementation.
+static StringList ToSortedList(const SmallUnorderedSet<String>& set)
+{
+	StringList list(set.begin(), set.end());
+	std::sort(list.begin(), list.end());
+	return list;
+}
+
+// Records the handler calls of a parse, with all names and values interned in a string table.
+class BaseXMLParser::CompiledWriter : public BinaryWriter {
+public:
+	void ElementStart(int line_number, const String& name, const XMLAttributes& attributes)
+	{
+		WriteNode(CompiledNodeType::ElementStart, line_number);
+		Write(WriteString(name));
+		Write((uint32_t)attributes.size());
+		for (const auto& pair : attributes)
+		{
+			Write(WriteString(pair.first));
+			Write(WriteString(pair.second.Get<String>()));
+		}
+	}
+
+	void ElementEnd(int line_number, const String& name)
+	{
+		WriteNode(CompiledNodeType::ElementEnd, line_number);
+		Write(WriteString(name));
+	}
+
+	void Data(int line_number, const String& data, XMLDataType type)
+	{
+		WriteNode(CompiledNodeType::Data, line_number);
+		Write((uint8_t)type);
+		Write(WriteString(data));
+	}
+
+	// Assembles the header, registrations, embedded source, and string table in front of the recorded nodes.
+	String Finish(const SmallUnorderedSet<String>& cdata_tags, const SmallUnorderedSet<String>& inner_xml_attributes, const String& source)
+	{
+		String nodes;
+		std::swap(buffer, nodes);
+		buffer.reserve(64 + source.size() + GetStringTableSize() + nodes.size());
+
+		WriteHeader(compiled_signature, compiled_version);
+
+		WriteStringList(ToSortedList(cdata_tags));
+		WriteStringList(ToSortedList(inner_xml_attributes));
+
+		Write((uint32_t)source.size());
+		buffer += source;
+
+		WriteStringTable();
+
+		Write(num_nodes);
+		buffer += nodes;
+
+		return std::move(buffer);
+	}
+
+private:
+	void WriteNode(CompiledNodeType type, int line_number)
+	{
+		Write((uint8_t)type);
+		Write((int32_t)line_number);
+		num_nodes++;
+	}
+
+	uint32_t num_nodes = 0;
+};
+
 BaseXMLParser::BaseXMLParser()
 {}
 
@@ -55,6 +141,46 @@ void BaseXMLParser::RegisterInnerXMLAttribute(const String& attribute_name)
 // Parses the given stream as an XML file, and calls the handlers when
 // interesting phenomenon are encountered.
 void BaseXMLParser::Parse(Stream* stream)
+{
+	ReadSource(stream);
+
+	if (!IsCompiledSource(xml_source) || !ReplayCompiled())
+		ParseSource();
+
+	xml_source.clear();
+	source_url = nullptr;
+}
+
+bool BaseXMLParser::Compile(Stream* stream, Stream* output)
+{
+	RMLUI_ZoneScoped;
+
+	ReadSource(stream);
+
+	bool result = false;
+	if (IsCompiledSource(xml_source))
+	{
+		// Already compiled, pass it through unchanged.
+		result = (output->Write(xml_source.data(), xml_source.size()) == xml_source.size());
+	}
+	else
+	{
+		CompiledWriter writer;
+		compiled_writer = &writer;
+		ParseSource();
+		compiled_writer = nullptr;
+
+		const String compiled_source = writer.Finish(cdata_tags, attributes_for_inner_xml_data, xml_source);
+		result = (output->Write(compiled_source.data(), compiled_source.size()) == compiled_source.size());
+	}
+
+	xml_source.clear();
+	source_url = nullptr;
+
+	return result;
+}
+
+void BaseXMLParser::ReadSource(Stream* stream)
 {
 	source_url = &stream->GetSourceURL();
 
@@ -66,7 +192,10 @@ void BaseXMLParser::Parse(Stream* stream)
 	// @performance Otherwise, use the temporary allocator.
 	const size_t source_size = stream->Length();
 	stream->Read(xml_source, source_size);
+}
 
+void BaseXMLParser::ParseSource()
+{
 	xml_index = 0;
 	line_number = 1;
 	line_number_open_tag = 1;
@@ -79,9 +208,116 @@ void BaseXMLParser::Parse(Stream* stream)
 	ReadHeader();
 	// Read the XML body.
 	ReadBody();
+}
 
-	xml_source.clear();
-	source_url = nullptr;
+bool BaseXMLParser::ReplayCompiled()
+{
+	RMLUI_ZoneScoped;
+
+	BinaryReader reader(xml_source.data(), xml_source.data() + xml_source.size());
+
+	if (!reader.ReadSignature(compiled_signature) || !reader.ReadVersion(compiled_version))
+	{
+		Log::Message(Log::LT_WARNING, "Compiled XML source %s is not compatible with this version of the library.", source_url->GetURL().c_str());
+		return true;
+	}
+
+	StringList compiled_cdata_tags, compiled_inner_xml_attributes;
+	const char* source = nullptr;
+	uint32_t source_size = 0;
+	if (!reader.Read(compiled_cdata_tags) || !reader.Read(compiled_inner_xml_attributes) || !reader.ReadView(source, source_size))
+	{
+		Log::Message(Log::LT_WARNING, "Invalid compiled XML source %s.", source_url->GetURL().c_str());
+		return true;
+	}
+
+	// The recorded handler calls depend on the registrations, parse the embedded source if they changed since compiling.
+	if (compiled_cdata_tags != ToSortedList(cdata_tags) || compiled_inner_xml_attributes != ToSortedList(attributes_for_inner_xml_data))
+	{
+		xml_source = String(source, source_size);
+		return false;
+	}
+
+	StringList strings;
+	uint32_t num_nodes = 0;
+	if (!reader.Read(strings) || !reader.Read(num_nodes))
+	{
+		Log::Message(Log::LT_WARNING, "Invalid compiled XML source %s.", source_url->GetURL().c_str());
+		return true;
+	}
+
+	auto read_nodes = [this, &strings, num_nodes](BinaryReader reader, bool call_handlers) -> bool {
+		for (uint32_t i = 0; i < num_nodes; i++)
+		{
+			uint8_t type = 0;
+			int32_t line = 0;
+			uint32_t name = 0;
+			if (!reader.Read(type) || !reader.Read(line))
+				return false;
+
+			if (call_handlers)
+				line_number = line;
+
+			switch ((CompiledNodeType)type)
+			{
+			case CompiledNodeType::ElementStart:
+			{
+				uint32_t num_attributes = 0;
+				if (!reader.ReadIndex(name, strings.size()) || !reader.Read(num_attributes))
+					return false;
+
+				if (call_handlers)
+					attributes.clear();
+
+				for (uint32_t j = 0; j < num_attributes; j++)
+				{
+					uint32_t attribute = 0, value = 0;
+					if (!reader.ReadIndex(attribute, strings.size()) || !reader.ReadIndex(value, strings.size()))
+						return false;
+					if (call_handlers)
+						attributes[strings[attribute]] = strings[value];
+				}
+
+				if (call_handlers)
+					HandleElementStartInternal(strings[name], attributes);
+			}
+			break;
+			case CompiledNodeType::ElementEnd:
+			{
+				if (!reader.ReadIndex(name, strings.size()))
+					return false;
+
+				if (call_handlers)
+					HandleElementEndInternal(strings[name]);
+			}
+			break;
+			case CompiledNodeType::Data:
+			{
+				uint8_t data_type = 0;
+				if (!reader.Read(data_type) || data_type > (uint8_t)XMLDataType::InnerXML || !reader.ReadIndex(name, strings.size()))
+					return false;
+
+				if (call_handlers)
+					HandleDataInternal(strings[name], (XMLDataType)data_type);
+			}
+			break;
+			default:
+				return false;
+			}
+		}
+		return reader.AtEnd();
+	};
+
+	// Validate all the nodes before calling any handlers, so that a corrupt source does not leave a partial document.
+	if (!read_nodes(reader, false))
+	{
+		Log::Message(Log::LT_WARNING, "Invalid compiled XML source %s.", source_url->GetURL().c_str());
+		return true;
+	}
+
+	read_nodes(reader, true);
+
+	return true;
 }
 
 // Get the current file line number
@@ -138,19 +374,34 @@ char BaseXMLParser::Look() const {
 void BaseXMLParser::HandleElementStartInternal(const String& name, const XMLAttributes& attributes)
 {
 	line_number_open_tag = line_number;
-	if (!inner_xml_data)
+	if (inner_xml_data)
+		return;
+
+	if (compiled_writer)
+		compiled_writer->ElementStart(line_number, name, attributes);
+	else
 		HandleElementStart(name, attributes);
 }
 
 void BaseXMLParser::HandleElementEndInternal(const String& name)
 {
-	if (!inner_xml_data)
+	if (inner_xml_data)
+		return;
+
+	if (compiled_writer)
+		compiled_writer->ElementEnd(line_number, name);
+	else
 		HandleElementEnd(name);
 }
 
 void BaseXMLParser::HandleDataInternal(const String& data, XMLDataType type)
 {
-	if (!inner_xml_data)
+	if (inner_xml_data)
+		return;
+
+	if (compiled_writer)
+		compiled_writer->Data(line_number, data, type);
+	else
 		HandleData(data, type);
 }
 
@@ -254,7 +505,7 @@ bool BaseXMLParser::ReadOpenTag()
 	{
 		// It appears we have some attributes. Let's parse them.
 		bool parse_inner_xml_as_data = false;
-		XMLAttributes attributes;
+		attributes.clear();
 		if (!ReadAttributes(attributes, parse_inner_xml_as_data))
 			return false;
 
@@ -349,10 +600,13 @@ bool BaseXMLParser::ReadCloseTag(const size_t xml_index_tag)
 
 bool BaseXMLParser::ReadAttributes(XMLAttributes& attributes, bool& parse_raw_xml_content)
 {
+	String attribute;
+	String value;
+
 	for (;;)
 	{
-		String attribute;
-		String value;
+		attribute.clear();
+		value.clear();
 
 		// Get the attribute name		
 		if (!FindWord(attribute, "=/>"))
@@ -382,7 +636,11 @@ bool BaseXMLParser::ReadAttributes(XMLAttributes& attributes, bool& parse_raw_xm
 		if (attributes_for_inner_xml_data.count(attribute) == 1)
 			parse_raw_xml_content = true;
 
- 		attributes[attribute] = StringUtilities::DecodeRml(value);
+		// Only values containing entities need to be decoded.
+		if (value.find('&') != String::npos)
+			value = StringUtilities::DecodeRml(value);
+
+		attributes[attribute] = std::move(value);
 
 		// Check for the end of the tag.
 		if (PeekString("/", false) || PeekString(">", false))
@@ -436,55 +694,46 @@ bool BaseXMLParser::ReadCDATA(const char* tag_terminator)
 // Reads from the stream until a complete word is found.
 bool BaseXMLParser::FindWord(String& word, const char* terminators)
 {
-	while (!AtEnd())
-	{
-		char c = Look();
+	const char* const source_end = xml_source.data() + xml_source.size();
+	const char* it = xml_source.data() + xml_index;
 
-		// Count line numbers
-		if (c == '\n')
-		{
+	// Ignore leading white space
+	for (; it != source_end && StringUtilities::IsWhitespace(*it); ++it)
+	{
+		if (*it == '\n')
 			line_number++;
-		}
+	}
 
-		// Ignore white space
-		if (StringUtilities::IsWhitespace(c))
-		{
-			if (word.empty())
-			{
-				Next();
-				continue;
-			}
-			else
-				return true;
-		}
+	// Find the end of the word, then append it in one go.
+	const char* const word_begin = it;
+	while (it != source_end && !StringUtilities::IsWhitespace(*it) && !(terminators && strchr(terminators, *it)))
+		++it;
 
-		// Check for termination condition
-		if (terminators && strchr(terminators, c))
-		{
-			return !word.empty();
-		}
+	word.append(word_begin, it);
+	xml_index = size_t(it - xml_source.data());
 
-		word += c;
-		Next();
-	}
+	if (it == source_end)
+		return false;
 
-	return false;
+	return !word.empty();
 }
 
 // Reads from the stream until the given character set is found.
 bool BaseXMLParser::FindString(const char* string, String& data, bool escape_brackets)
 {
-	int index = 0;
+	const size_t string_length = strlen(string);
+	const char* const source_begin = xml_source.data();
+	const char* const source_end = source_begin + xml_source.size();
+	const char* it = source_begin + xml_index;
+	const char* const data_begin = it;
+
 	bool in_brackets = false;
 	bool in_string = false;
 	char previous = 0;
 
-	while (string[index])
+	for (; it != source_end; ++it)
 	{
-		if (AtEnd())
-			return false;
-
-		const char c = Look();
+		const char c = *it;
 
 		// Count line numbers
 		if (c == '\n')
@@ -492,36 +741,33 @@ bool BaseXMLParser::FindString(const char* string, String& data, bool escape_bra
 			line_number++;
 		}
 
-		if(escape_brackets)
+		// Outside of data expressions, only curly brackets can change the bracket state.
+		if (escape_brackets && (in_brackets || c == '{' || c == '}'))
 		{
 			const char* error_str = XMLParseTools::ParseDataBrackets(in_brackets, in_string, c, previous);
 			if (error_str)
 			{
 				Log::Message(Log::LT_WARNING, "XML parse error. %s", error_str);
+				data.append(data_begin, it);
+				xml_index = size_t(it - source_begin);
 				return false;
 			}
 		}
 
-		if (c == string[index] && !in_brackets)
+		if (c == string[0] && !in_brackets && size_t(source_end - it) >= string_length && memcmp(it, string, string_length) == 0)
 		{
-			index += 1;
-		}
-		else
-		{
-			if (index > 0)
-			{
-				data += String(string, index);
-				index = 0;
-			}
-
-			data += c;
+			data.append(data_begin, it);
+			xml_index = size_t(it - source_begin) + string_length;
+			return true;
 		}
 
 		previous = c;
-		Next();
 	}
 
-	return true;
+	data.append(data_begin, it);
+	xml_index = xml_source.size();
+
+	return false;
 }
 
 // Returns true if the next sequence of characters in the stream matches the
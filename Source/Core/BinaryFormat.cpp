@@ -0,0 +1,139 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "BinaryFormat.h"
+
+namespace Rml {
+
+// Written in native byte order, used to reject files written on a platform with a different byte order.
+static constexpr uint32_t byte_order_mark = 0x01020304;
+
+void BinaryWriter::WriteHeader(const char* signature, uint32_t version)
+{
+	buffer.append(signature, signature_size);
+	Write(version);
+	Write(byte_order_mark);
+}
+
+void BinaryWriter::WriteStringList(const StringList& list)
+{
+	Write((uint32_t)list.size());
+	for (const String& string : list)
+	{
+		Write((uint32_t)string.size());
+		buffer += string;
+	}
+}
+
+uint32_t BinaryWriter::WriteString(const String& string)
+{
+	auto result = string_indices.emplace(string, (uint32_t)strings.size());
+	if (result.second)
+	{
+		strings.push_back(string);
+		strings_size += string.size() + sizeof(uint32_t);
+	}
+	return result.first->second;
+}
+
+void BinaryWriter::WriteStringTable()
+{
+	WriteStringList(strings);
+}
+
+size_t BinaryWriter::GetStringTableSize() const
+{
+	return strings_size;
+}
+
+BinaryReader::BinaryReader(const char* begin, const char* end) : it(begin), end(end)
+{}
+
+bool BinaryReader::ReadSignature(const char* signature)
+{
+	if (GetNumRemainingBytes() < BinaryWriter::signature_size || memcmp(it, signature, BinaryWriter::signature_size) != 0)
+		return false;
+	it += BinaryWriter::signature_size;
+	return true;
+}
+
+bool BinaryReader::ReadVersion(uint32_t version)
+{
+	uint32_t read_version = 0;
+	uint32_t read_byte_order_mark = 0;
+	return Read(read_version) && read_version == version && Read(read_byte_order_mark) && read_byte_order_mark == byte_order_mark;
+}
+
+bool BinaryReader::ReadBytes(void* destination, size_t size)
+{
+	if (GetNumRemainingBytes() < size)
+		return false;
+	memcpy(destination, it, size);
+	it += size;
+	return true;
+}
+
+bool BinaryReader::ReadView(const char*& data, uint32_t& size)
+{
+	if (!Read(size) || GetNumRemainingBytes() < size)
+		return false;
+	data = it;
+	it += size;
+	return true;
+}
+
+bool BinaryReader::Read(String& string)
+{
+	const char* data = nullptr;
+	uint32_t size = 0;
+	if (!ReadView(data, size))
+		return false;
+	string.assign(data, size);
+	return true;
+}
+
+bool BinaryReader::Read(StringList& list)
+{
+	uint32_t size = 0;
+	// Every string takes at least the bytes of its size.
+	if (!Read(size) || GetNumRemainingBytes() / sizeof(uint32_t) < size)
+		return false;
+	list.resize(size);
+	for (String& string : list)
+	{
+		if (!Read(string))
+			return false;
+	}
+	return true;
+}
+
+bool BinaryReader::ReadIndex(uint32_t& index, size_t num_strings)
+{
+	return Read(index) && index < num_strings;
+}
+
+} // namespace Rml
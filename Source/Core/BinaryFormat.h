@@ -0,0 +1,121 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_BINARYFORMAT_H
+#define RMLUI_CORE_BINARYFORMAT_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+namespace Rml {
+
+/**
+	Writes the compiled binary formats of documents and style sheets.
+
+	Values are written in native byte order. Strings are interned in a string table and referred to by their index.
+ */
+
+class BinaryWriter {
+public:
+	/// The number of bytes in the signature at the start of every binary format.
+	static constexpr size_t signature_size = 8;
+
+	/// Writes the signature and the format version, followed by a byte order mark which rejects files written on a
+	/// platform with a different byte order.
+	void WriteHeader(const char* signature, uint32_t version);
+
+	template <typename T>
+	void Write(const T& value)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be written directly.");
+		buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	/// Writes the number of strings in the list, followed by each string prefixed by its size.
+	void WriteStringList(const StringList& list);
+
+	/// Interns the string and returns its index in the string table.
+	uint32_t WriteString(const String& string);
+	/// Writes the table of all interned strings, in the same layout as a string list.
+	void WriteStringTable();
+	/// Returns the number of bytes the string table will take up when written.
+	size_t GetStringTableSize() const;
+
+protected:
+	String buffer;
+
+private:
+	StringList strings;
+	size_t strings_size = sizeof(uint32_t);
+	UnorderedMap<String, uint32_t> string_indices;
+};
+
+/**
+	Bounds-checked reads from the binary formats written by BinaryWriter. All reads return false when there is not enough
+	data left.
+ */
+
+class BinaryReader {
+public:
+	BinaryReader(const char* begin, const char* end);
+
+	/// Returns true if the data starts with the given signature.
+	bool ReadSignature(const char* signature);
+	/// Returns true if the format version and the byte order written after the signature match the given version and the
+	/// byte order of this platform.
+	bool ReadVersion(uint32_t version);
+
+	template <typename T>
+	bool Read(T& value)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be read directly.");
+		return ReadBytes(&value, sizeof(T));
+	}
+
+	bool ReadBytes(void* destination, size_t size);
+
+	/// Reads a string without copying it, the data points into the read buffer.
+	bool ReadView(const char*& data, uint32_t& size);
+
+	bool Read(String& string);
+	bool Read(StringList& list);
+
+	/// Reads a string index, which must be less than the number of strings in the string table.
+	bool ReadIndex(uint32_t& index, size_t num_strings);
+
+	size_t GetNumRemainingBytes() const { return size_t(end - it); }
+	bool AtEnd() const { return it == end; }
+
+private:
+	const char* it;
+	const char* end;
+};
+
+} // namespace Rml
+#endif
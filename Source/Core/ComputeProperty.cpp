@@ -194,16 +194,16 @@ float ComputeFontsize(const Property& property, const Style::ComputedValues& val
 		case Property::EM:
 			if (!parent_values)
 				return 0;
-			return property.value.Get< float >() * multiplier * parent_values->font_size;
+			return property.value.Get< float >() * multiplier * parent_values->inherited->font_size;
 
 		case Property::REM:
 			if (!document_values)
 				return 0;
 			// If the current element is a document, the rem unit is relative to the default size
 			if(&values == document_values)
-				return property.value.Get< float >() * DefaultComputedValues.font_size;
+				return property.value.Get< float >() * DefaultComputedValues.inherited->font_size;
 			// Otherwise it is relative to the document font size
-			return property.value.Get< float >() * document_values->font_size;
+			return property.value.Get< float >() * document_values->inherited->font_size;
 		default:
 			RMLUI_ERRORMSG("A relative unit must be percentage, em or rem.");
 		}
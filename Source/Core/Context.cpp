@@ -39,9 +39,14 @@
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "DataModel.h"
+#include "DocumentCache.h"
+#include "DrawListRecorder.h"
 #include "EventDispatcher.h"
+#include "HitTestGrid.h"
+#include "Memory.h"
 #include "PluginRegistry.h"
 #include "StreamFile.h"
+#include "WorkerPool.h"
 #include <algorithm>
 #include <iterator>
 
@@ -96,6 +101,8 @@ Context::Context(const String& name) : name(name), dimensions(0, 0), density_ind
 	last_click_element = nullptr;
 	last_click_time = 0;
 	last_click_mouse_position = Vector2i(0, 0);
+
+	frame_arena = MakeUnique<FrameArena>();
 }
 
 Context::~Context()
@@ -181,18 +188,30 @@ bool Context::Update()
 {
 	RMLUI_ZoneScoped;
 
+	FrameArenaScope frame_arena_scope(frame_arena.get());
+
+	// Publish the results of finished background tasks, such as font textures, before they are needed by this update.
+	WorkerPool::ProcessCompletedTasks();
+
 	// Update all data models first
 	for (auto& data_model : data_models)
 		data_model.second->Update(true);
 
-	root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	if (parallel_update)
+	{
+		UpdateDocumentsParallel();
+	}
+	else
+	{
+		root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
 
-	for (int i = 0; i < root->GetNumChildren(); ++i)
-		if (auto doc = root->GetChild(i)->GetOwnerDocument())
-		{
-			doc->UpdateLayout();
-			doc->UpdatePosition();
-		}
+		for (int i = 0; i < root->GetNumChildren(); ++i)
+			if (auto doc = root->GetChild(i)->GetOwnerDocument())
+			{
+				doc->UpdateLayout();
+				doc->UpdatePosition();
+			}
+	}
 
 	// Release any documents that were unloaded during the update.
 	ReleaseUnloadedDocuments();
@@ -205,11 +224,41 @@ bool Context::Render()
 {
 	RMLUI_ZoneScoped;
 
+	FrameArenaScope frame_arena_scope(frame_arena.get());
+
 	RenderInterface* render_interface = GetRenderInterface();
 	if (render_interface == nullptr)
 		return false;
 
 	render_interface->context = this;
+
+	if (drag_clone)
+	{
+		static_cast<ElementDocument&>(*cursor_proxy).UpdateDocument();
+		cursor_proxy->SetOffset(Vector2f((float)Math::Clamp(mouse_position.x, 0, dimensions.x),
+			(float)Math::Clamp(mouse_position.y, 0, dimensions.y)),
+			nullptr);
+	}
+
+	if (draw_list_recorder)
+	{
+		// In retained mode, submit the previous draw list again if no elements have changed since it was recorded.
+		if (draw_list_recorder->IsRetained() && !root->render_dirty && !cursor_proxy->render_dirty && draw_list_recorder->CanReuseLastDrawList())
+		{
+			RMLUI_ZoneScopedN("RenderDrawList");
+			render_interface->RenderDrawList(draw_list_recorder->GetLastDrawList());
+			render_interface->context = nullptr;
+			return true;
+		}
+
+		draw_list_recorder->Begin();
+	}
+
+	// The root is not part of any document, thus it is always rendered and never replayed.
+	root->render_dirty = false;
+	if (!drag_clone)
+		cursor_proxy->render_dirty = false;
+
 	ElementUtilities::ApplyActiveClipRegion(this, render_interface);
 
 	root->Render();
@@ -218,12 +267,12 @@ bool Context::Render()
 
 	// Render the cursor proxy so that any attached drag clone will be rendered below the cursor.
 	if (drag_clone)
-	{
-		static_cast<ElementDocument&>(*cursor_proxy).UpdateDocument();
-		cursor_proxy->SetOffset(Vector2f((float)Math::Clamp(mouse_position.x, 0, dimensions.x),
-			(float)Math::Clamp(mouse_position.y, 0, dimensions.y)),
-			nullptr);
 		cursor_proxy->Render();
+
+	if (draw_list_recorder)
+	{
+		RMLUI_ZoneScopedN("RenderDrawList");
+		render_interface->RenderDrawList(draw_list_recorder->End());
 	}
 
 	render_interface->context = nullptr;
@@ -231,6 +280,40 @@ bool Context::Render()
 	return true;
 }
 
+void Context::EnableDrawListRendering(bool enable)
+{
+	if (enable && !draw_list_recorder)
+		draw_list_recorder = MakeUnique<DrawListRecorder>(false);
+	else if (!enable)
+		draw_list_recorder.reset();
+}
+
+bool Context::IsDrawListRenderingEnabled() const
+{
+	return draw_list_recorder != nullptr;
+}
+
+void Context::EnableRetainedRendering(bool enable)
+{
+	if (enable != IsRetainedRenderingEnabled())
+		draw_list_recorder = MakeUnique<DrawListRecorder>(enable);
+}
+
+bool Context::IsRetainedRenderingEnabled() const
+{
+	return draw_list_recorder && draw_list_recorder->IsRetained();
+}
+
+void Context::EnableParallelUpdate(bool enable)
+{
+	parallel_update = enable;
+}
+
+bool Context::IsParallelUpdateEnabled() const
+{
+	return parallel_update;
+}
+
 // Creates a new, empty document and places it into this context. 
 ElementDocument* Context::CreateDocument(const String& instancer_name)
 {
@@ -259,6 +342,19 @@ ElementDocument* Context::CreateDocument(const String& instancer_name)
 // Load a document into the context.
 ElementDocument* Context::LoadDocument(const String& document_path)
 {	
+	// Cached documents are instanced from their compiled RML, without reading the file.
+	if (DocumentCache::IsEnabled())
+	{
+		SharedPtr<const String> document_rml = DocumentCache::GetDocument(document_path);
+		if (!document_rml)
+			return nullptr;
+
+		auto stream = MakeUnique<StreamMemory>((const byte*)document_rml->data(), document_rml->size());
+		stream->SetSourceURL(StringUtilities::Replace(document_path, ':', '|'));
+
+		return LoadDocument(stream.get());
+	}
+
 	auto stream = MakeUnique<StreamFile>();
 
 	if (!stream->Open(document_path))
@@ -531,6 +627,8 @@ void Context::RemoveEventListener(const String& event, EventListener* listener,
 // Sends a key down event into RmlUi.
 bool Context::ProcessKeyDown(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
+	FrameArenaScope frame_arena_scope(frame_arena.get());
+
 	// Generate the parameters for the key event.
 	Dictionary parameters;
 	GenerateKeyEventParameters(parameters, key_identifier);
@@ -545,6 +643,8 @@ bool Context::ProcessKeyDown(Input::KeyIdentifier key_identifier, int key_modifi
 // Sends a key up event into RmlUi.
 bool Context::ProcessKeyUp(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
+	FrameArenaScope frame_arena_scope(frame_arena.get());
+
 	// Generate the parameters for the key event.
 	Dictionary parameters;
 	GenerateKeyEventParameters(parameters, key_identifier);
@@ -575,6 +675,8 @@ bool Context::ProcessTextInput(Character character)
 // Sends a string of text as text input into RmlUi.
 bool Context::ProcessTextInput(const String& string)
 {
+	FrameArenaScope frame_arena_scope(frame_arena.get());
+
 	Element* target = (focus ? focus : root.get());
 
 	Dictionary parameters;
@@ -588,6 +690,8 @@ bool Context::ProcessTextInput(const String& string)
 // Sends a mouse movement event into RmlUi.
 bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 {
+	FrameArenaScope frame_arena_scope(frame_arena.get());
+
 	// Check whether the mouse moved since the last event came through.
 	Vector2i old_mouse_position = mouse_position;
 	bool mouse_moved = (x != mouse_position.x) || (y != mouse_position.y);
@@ -630,10 +734,10 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 static Element* FindFocusElement(Element* element)
 {
 	ElementDocument* owner_document = element->GetOwnerDocument();
-	if (!owner_document || owner_document->GetComputedValues().focus == Style::Focus::None)
+	if (!owner_document || owner_document->GetComputedValues().inherited->focus == Style::Focus::None)
 		return nullptr;
 	
-	while (element && element->GetComputedValues().focus == Style::Focus::None)
+	while (element && element->GetComputedValues().inherited->focus == Style::Focus::None)
 	{
 		element = element->GetParentNode();
 	}
@@ -644,6 +748,8 @@ static Element* FindFocusElement(Element* element)
 // Sends a mouse-button down event into RmlUi.
 bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 {
+	FrameArenaScope frame_arena_scope(frame_arena.get());
+
 	Dictionary parameters;
 	GenerateMouseEventParameters(parameters, button_index);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
@@ -709,7 +815,7 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 			drag = hover;
 			while (drag)
 			{
-				Style::Drag drag_style = drag->GetComputedValues().drag;
+				Style::Drag drag_style = drag->GetComputedValues().rare->drag;
 				switch (drag_style)
 				{
 				case Style::Drag::None:		drag = drag->GetParentNode(); continue;
@@ -734,6 +840,8 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 // Sends a mouse-button up event into RmlUi.
 bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 {
+	FrameArenaScope frame_arena_scope(frame_arena.get());
+
 	Dictionary parameters;
 	GenerateMouseEventParameters(parameters, button_index);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
@@ -810,6 +918,8 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 // Sends a mouse-wheel movement event into RmlUi.
 bool Context::ProcessMouseWheel(float wheel_delta, int key_modifier_state)
 {
+	FrameArenaScope frame_arena_scope(frame_arena.get());
+
 	if (hover)
 	{
 		Dictionary scroll_parameters;
@@ -1056,7 +1166,7 @@ void Context::UpdateHoverChain(const Dictionary& parameters, const Dictionary& d
 				drag->DispatchEvent(EventId::Dragstart, drag_start_parameters);
 				drag_started = true;
 
-				if (drag->GetComputedValues().drag == Style::Drag::Clone)
+				if (drag->GetComputedValues().rare->drag == Style::Drag::Clone)
 				{
 					// Clone the element and attach it to the mouse cursor.
 					CreateDragClone(drag);
@@ -1074,9 +1184,9 @@ void Context::UpdateHoverChain(const Dictionary& parameters, const Dictionary& d
 		String new_cursor_name;
 
 		if(drag)
-			new_cursor_name = drag->GetComputedValues().cursor;
+			new_cursor_name = drag->GetComputedValues().inherited->cursor;
 		else if (hover)
-			new_cursor_name = hover->GetComputedValues().cursor;
+			new_cursor_name = hover->GetComputedValues().inherited->cursor;
 
 		if(new_cursor_name != cursor_name)
 		{
@@ -1159,8 +1269,7 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 		if (element->stacking_context_dirty)
 			element->BuildLocalStackingContext();
 
-		for (int i = (int) element->stacking_context.size() - 1; i >= 0; --i)
-		{
+		auto TestStackingContextElement = [&](int i) -> Element* {
 			if (ignore_element != nullptr)
 			{
 				Element* element_hierarchy = element->stacking_context[i];
@@ -1173,17 +1282,30 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 				}
 
 				if (element_hierarchy != nullptr)
-					continue;
+					return nullptr;
 			}
 
-			Element* child_element = GetElementAtPoint(point, ignore_element, element->stacking_context[i]);
-			if (child_element != nullptr)
+			return GetElementAtPoint(point, ignore_element, element->stacking_context[i]);
+		};
+
+		// Large stacking contexts use a grid to only test the elements whose boxes may contain the point.
+		if (const HitTestGrid* grid = element->GetHitTestGrid())
+		{
+			if (Element* child_element = grid->Find(point, TestStackingContextElement))
 				return child_element;
 		}
+		else
+		{
+			for (int i = (int)element->stacking_context.size() - 1; i >= 0; --i)
+			{
+				if (Element* child_element = TestStackingContextElement(i))
+					return child_element;
+			}
+		}
 	}
 
 	// Ignore elements whose pointer events are disabled.
-	if (element->GetComputedValues().pointer_events == Style::PointerEvents::None)
+	if (element->GetComputedValues().inherited->pointer_events == Style::PointerEvents::None)
 		return nullptr;
 
 	// Projection may fail if we have a singular transformation matrix.
@@ -1271,6 +1393,13 @@ DataModel* Context::GetDataModelPtr(const String& name) const
 	return nullptr;
 }
 
+DrawListRecorder* Context::GetActiveDrawListRecorder() const
+{
+	if (draw_list_recorder && draw_list_recorder->IsRecording())
+		return draw_list_recorder.get();
+	return nullptr;
+}
+
 // Builds the parameters for a generic key event.
 void Context::GenerateKeyEventParameters(Dictionary& parameters, Input::KeyIdentifier key_identifier)
 {
@@ -1311,6 +1440,40 @@ void Context::GenerateDragEventParameters(Dictionary& parameters)
 }
 
 // Releases all unloaded documents pending destruction.
+void Context::UpdateDocumentsParallel()
+{
+	RMLUI_ZoneScoped;
+
+	const float dp_ratio = density_independent_pixel_ratio;
+	const Vector2f vp_dimensions(dimensions);
+
+	// The documents inherit their properties from the root, thus it must be updated first.
+	root->UpdateSelf(dp_ratio, vp_dimensions);
+
+	// Documents loaded by event handlers during the update are not included until the next update.
+	Vector<Element*> children;
+	children.reserve(root->children.size());
+	for (const ElementPtr& child : root->children)
+		children.push_back(child.get());
+
+	WorkerPool::ParallelFor((int)children.size(), [&children, dp_ratio, vp_dimensions](int i) {
+		Element* child = children[i];
+		child->Update(dp_ratio, vp_dimensions);
+
+		if (ElementDocument* document = child->GetOwnerDocument())
+		{
+			document->UpdateLayout();
+			document->UpdatePosition();
+		}
+	});
+
+	for (Element* child : children)
+	{
+		if (child->render_dirty)
+			root->render_dirty = true;
+	}
+}
+
 void Context::ReleaseUnloadedDocuments()
 {
 	if (!unloaded_documents.empty())
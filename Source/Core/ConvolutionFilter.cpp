@@ -28,9 +28,19 @@
 
 #include "../../Include/RmlUi/Core/ConvolutionFilter.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "Memory.h"
 #include <float.h>
+#include <math.h>
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RMLUI_CONVOLUTION_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#define RMLUI_CONVOLUTION_NEON
+	#include <arm_neon.h>
+#endif
+
 namespace Rml {
 
 ConvolutionFilter::ConvolutionFilter()
@@ -69,12 +79,11 @@ float* ConvolutionFilter::operator[](int kernel_y_index)
 	return kernel.get() + kernel_size.x * kernel_y_index;
 }
 
-void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimensions, const int destination_stride,
+// Reference implementation, applies the full kernel to every destination pixel.
+static void RunReference(byte* destination, const Vector2i destination_dimensions, const int destination_stride,
 	const ColorFormat destination_color_format, const byte* source, const Vector2i source_dimensions, const Vector2i source_offset,
-	const ColorFormat source_color_format) const
+	const ColorFormat source_color_format, const float* kernel, const Vector2i kernel_size, const FilterOperation operation)
 {
-	RMLUI_ZoneScopedNC("ConvFilter::Run", 0xd6bf49);
-
 	const int destination_bytes_per_pixel = (destination_color_format == ColorFormat::RGBA8 ? 4 : 1);
 	const int destination_alpha_offset = (destination_color_format == ColorFormat::RGBA8 ? 3 : 0);
 	const int source_bytes_per_pixel = (source_color_format == ColorFormat::RGBA8 ? 4 : 1);
@@ -125,4 +134,182 @@ void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimens
 	}
 }
 
+// Splits the kernel into a row and a column kernel, whose outer product equals the kernel. Returns false if the kernel is not separable.
+static bool SeparateKernel(const float* kernel, const Vector2i kernel_size, float* row_kernel, float* column_kernel)
+{
+	// One-dimensional kernels are split exactly, so that they give the same results as the reference implementation.
+	if (kernel_size.y == 1)
+	{
+		memcpy(row_kernel, kernel, sizeof(float) * kernel_size.x);
+		column_kernel[0] = 1.f;
+		return true;
+	}
+	if (kernel_size.x == 1)
+	{
+		row_kernel[0] = 1.f;
+		memcpy(column_kernel, kernel, sizeof(float) * kernel_size.y);
+		return true;
+	}
+
+	// Use the largest value as the pivot, the kernel is separable if it equals the product of the pivot's row and column.
+	int pivot_x = 0;
+	int pivot_y = 0;
+	float pivot_value = 0.f;
+
+	for (int y = 0; y < kernel_size.y; y++)
+	{
+		for (int x = 0; x < kernel_size.x; x++)
+		{
+			const float value = kernel[y * kernel_size.x + x];
+			if (fabsf(value) > fabsf(pivot_value))
+			{
+				pivot_x = x;
+				pivot_y = y;
+				pivot_value = value;
+			}
+		}
+	}
+
+	for (int x = 0; x < kernel_size.x; x++)
+		row_kernel[x] = kernel[pivot_y * kernel_size.x + x];
+
+	for (int y = 0; y < kernel_size.y; y++)
+		column_kernel[y] = (pivot_value == 0.f ? 0.f : kernel[y * kernel_size.x + pivot_x] / pivot_value);
+
+	const float tolerance = 1e-5f * fabsf(pivot_value);
+
+	for (int y = 0; y < kernel_size.y; y++)
+	{
+		for (int x = 0; x < kernel_size.x; x++)
+		{
+			if (fabsf(kernel[y * kernel_size.x + x] - column_kernel[y] * row_kernel[x]) > tolerance)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// Convolves each row of the source with the kernel, writing 'width' values per row. Each source row must have room for all the
+// kernel's taps, i.e. 'width + kernel_length - 1' values. With a source stride of one value, and a step of one row, this
+// instead convolves along the columns.
+static void ConvolveRows(float* destination, const int width, const int height, const float* source, const int source_stride,
+	const int source_step, const float* kernel, const int kernel_length, const bool vectorise)
+{
+	for (int y = 0; y < height; y++)
+	{
+		const float* source_row = source + y * source_stride;
+		float* destination_row = destination + y * width;
+		int x = 0;
+
+#if defined(RMLUI_CONVOLUTION_SSE2)
+		if (vectorise)
+		{
+			for (; x + 4 <= width; x += 4)
+			{
+				__m128 sum = _mm_setzero_ps();
+				for (int k = 0; k < kernel_length; k++)
+					sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(kernel[k]), _mm_loadu_ps(source_row + k * source_step + x)));
+				_mm_storeu_ps(destination_row + x, sum);
+			}
+		}
+#elif defined(RMLUI_CONVOLUTION_NEON)
+		if (vectorise)
+		{
+			for (; x + 4 <= width; x += 4)
+			{
+				float32x4_t sum = vdupq_n_f32(0.f);
+				for (int k = 0; k < kernel_length; k++)
+					sum = vaddq_f32(sum, vmulq_f32(vdupq_n_f32(kernel[k]), vld1q_f32(source_row + k * source_step + x)));
+				vst1q_f32(destination_row + x, sum);
+			}
+		}
+#else
+		(void)vectorise;
+#endif
+
+		for (; x < width; x++)
+		{
+			float sum = 0.f;
+			for (int k = 0; k < kernel_length; k++)
+				sum += kernel[k] * source_row[k * source_step + x];
+			destination_row[x] = sum;
+		}
+	}
+}
+
+// Applies a separable summing kernel as a horizontal pass followed by a vertical pass. Each pass can be vectorised.
+static void RunSeparable(byte* destination, const Vector2i destination_dimensions, const int destination_stride,
+	const ColorFormat destination_color_format, const byte* source, const Vector2i source_dimensions, const Vector2i source_offset,
+	const ColorFormat source_color_format, const float* row_kernel, const float* column_kernel, const Vector2i kernel_size, const bool vectorise)
+{
+	const int destination_bytes_per_pixel = (destination_color_format == ColorFormat::RGBA8 ? 4 : 1);
+	const int destination_alpha_offset = (destination_color_format == ColorFormat::RGBA8 ? 3 : 0);
+	const int source_bytes_per_pixel = (source_color_format == ColorFormat::RGBA8 ? 4 : 1);
+	const int source_alpha_offset = (source_color_format == ColorFormat::RGBA8 ? 3 : 0);
+
+	const Vector2i kernel_radius = (kernel_size - Vector2i(1)) / 2;
+
+	// Convert the source opacity to floats, padded with zeros so that every tap of the kernel is within the padded area.
+	const Vector2i padded_dimensions = destination_dimensions + kernel_size - Vector2i(1);
+	const Vector2i padded_origin = source_offset + kernel_radius;
+
+	DynamicArray<float, GlobalStackAllocator<float>> padded(padded_dimensions.x * padded_dimensions.y);
+	for (int y = 0; y < padded_dimensions.y; y++)
+	{
+		float* padded_row = padded.data() + y * padded_dimensions.x;
+		const int source_y = y - padded_origin.y;
+
+		for (int x = 0; x < padded_dimensions.x; x++)
+		{
+			const int source_x = x - padded_origin.x;
+			if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
+				padded_row[x] = float(source[(source_y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset]);
+			else
+				padded_row[x] = 0.f;
+		}
+	}
+
+	DynamicArray<float, GlobalStackAllocator<float>> horizontal(destination_dimensions.x * padded_dimensions.y);
+	ConvolveRows(horizontal.data(), destination_dimensions.x, padded_dimensions.y, padded.data(), padded_dimensions.x, 1, row_kernel,
+		kernel_size.x, vectorise);
+
+	DynamicArray<float, GlobalStackAllocator<float>> vertical(destination_dimensions.x * destination_dimensions.y);
+	ConvolveRows(vertical.data(), destination_dimensions.x, destination_dimensions.y, horizontal.data(), destination_dimensions.x,
+		destination_dimensions.x, column_kernel, kernel_size.y, vectorise);
+
+	for (int y = 0; y < destination_dimensions.y; y++)
+	{
+		const float* vertical_row = vertical.data() + y * destination_dimensions.x;
+		for (int x = 0; x < destination_dimensions.x; x++)
+			destination[x * destination_bytes_per_pixel + destination_alpha_offset] = byte(Math::Min(255.f, vertical_row[x]));
+
+		destination += destination_stride;
+	}
+}
+
+void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimensions, const int destination_stride,
+	const ColorFormat destination_color_format, const byte* source, const Vector2i source_dimensions, const Vector2i source_offset,
+	const ColorFormat source_color_format) const
+{
+	RMLUI_ZoneScopedNC("ConvFilter::Run", 0xd6bf49);
+
+	// Summing kernels such as Gaussian blurs are separable, then we can run them as two one-dimensional passes.
+	if (operation == FilterOperation::Sum)
+	{
+		DynamicArray<float, GlobalStackAllocator<float>> row_kernel(kernel_size.x);
+		DynamicArray<float, GlobalStackAllocator<float>> column_kernel(kernel_size.y);
+
+		if (SeparateKernel(kernel.get(), kernel_size, row_kernel.data(), column_kernel.data()))
+		{
+			RunSeparable(destination, destination_dimensions, destination_stride, destination_color_format, source, source_dimensions,
+				source_offset, source_color_format, row_kernel.data(), column_kernel.data(), kernel_size, true);
+			return;
+		}
+	}
+
+	RunReference(destination, destination_dimensions, destination_stride, destination_color_format, source, source_dimensions, source_offset,
+		source_color_format, kernel.get(), kernel_size, operation);
+}
+
 } // namespace Rml
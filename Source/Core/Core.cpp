@@ -43,8 +43,10 @@
 #include "PluginRegistry.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetParser.h"
+#include "DocumentCache.h"
 #include "TemplateCache.h"
 #include "TextureDatabase.h"
+#include "WorkerPool.h"
 #include "EventSpecification.h"
 
 #ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
@@ -77,6 +79,9 @@ static FontEngineInterface* font_interface = nullptr;
 static UniquePtr<FileInterface> default_file_interface;
 static UniquePtr<FontEngineInterface> default_font_interface;
 
+// The number of worker threads to start, negative to choose one based on the hardware.
+static int num_worker_threads = -1;
+
 static bool initialised = false;
 
 using ContextMap = UnorderedMap< String, ContextPtr >;
@@ -129,11 +134,14 @@ bool Initialise()
 #endif
 	}
 
+	WorkerPool::Initialise(num_worker_threads);
+
 	StyleSheetSpecification::Initialise();
 	StyleSheetParser::Initialise();
 	StyleSheetFactory::Initialise();
 
 	TemplateCache::Initialise();
+	DocumentCache::Initialise();
 
 	Factory::Initialise();
 
@@ -164,11 +172,15 @@ void Shutdown()
 	PluginRegistry::NotifyShutdown();
 
 	Factory::Shutdown();
+	DocumentCache::Shutdown();
 	TemplateCache::Shutdown();
 	StyleSheetFactory::Shutdown();
 	StyleSheetParser::Shutdown();
 	StyleSheetSpecification::Shutdown();
 
+	// Finish any background tasks before releasing the resources they may be using.
+	WorkerPool::Shutdown();
+
 	font_interface = nullptr;
 	default_font_interface.reset();
 
@@ -242,6 +254,12 @@ FontEngineInterface* GetFontEngineInterface()
 	return font_interface;
 }
 
+// Sets the number of worker threads to start during initialisation.
+void SetNumWorkerThreads(int num_threads)
+{
+	num_worker_threads = num_threads;
+}
+
 // Creates a new element context.
 Context* CreateContext(const String& name, const Vector2i dimensions, RenderInterface* custom_render_interface)
 {
@@ -31,7 +31,6 @@
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataModel.h"
-#include <stack>
 
 #ifdef _MSC_VER
 #pragma warning(default : 4061)
@@ -56,8 +55,9 @@ class DataParser;
 		S  The main program stack.
 		A  The arguments stack, only used to pass arguments to an external transform function.
 
-	In addition, each instruction has an optional payload:
-		D  Instruction data (payload).
+	In addition, each instruction has an optional integer payload:
+		D  Instruction data (payload). Literal values and function names are stored in the program's literal list,
+		   and referred to by their index.
 
 	Notation used in the instruction list below:
 		S+  Push to stack S.
@@ -67,7 +67,7 @@ enum class Instruction {
 	                        // Assignment (register/stack) = Read (register R/L/C, instruction data D, or stack)
 	Push         = 'P',     //      S+ = R
 	Pop          = 'o',     // <R/L/C> = S-  (D determines R/L/C)
-	Literal      = 'D',     //       R = D
+	Literal      = 'D',     //       R = Literals[D]
 	Variable     = 'V',     //       R = DataModel.GetVariable(D)  (D is an index into the variable address list)
 	Add          = '+',     //       R = L + R
 	Subtract     = '-',     //       R = L - R
@@ -84,8 +84,8 @@ enum class Instruction {
 	NotEqual     = 'N',     //       R = L != R
 	Ternary      = '?',     //       R = L ? C : R
 	Arguments    = 'a',     //      A+ = S-  (Repeated D times, where D gives the num. arguments)
-	TransformFnc = 'T',     //       R = DataModel.Execute( D, R, A ); A.Clear();  (D determines function name, R the input value, A the arguments)
-	EventFnc     = 'E',     //       DataModel.EventCallback(D, A); A.Clear();
+	TransformFnc = 'T',     //       R = DataModel.Execute( Literals[D], R, A ); A.Clear();  (D determines function name, R the input value, A the arguments)
+	EventFnc     = 'E',     //       DataModel.EventCallback(Literals[D], A); A.Clear();
 	Assign       = 'A',     //       DataModel.SetVariable(D, R)
 };
 
@@ -97,9 +97,72 @@ enum class Register {
 
 struct InstructionData {
 	Instruction instruction;
-	Variant data;
+	int data;
 };
 
+static inline double ToNumber(const Variant& value)
+{
+	return value.GetType() == Variant::DOUBLE ? value.GetReference<double>() : value.Get<double>();
+}
+static inline bool ToBool(const Variant& value)
+{
+	return value.GetType() == Variant::BOOL ? value.GetReference<bool>() : value.Get<bool>();
+}
+static inline bool AnyString(const Variant& v1, const Variant& v2)
+{
+	return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING;
+}
+
+// Executes the unary or binary operator instruction, R = L <op> R. Used by the interpreter, and for folding constants during parsing.
+static void ExecuteOperator(const Instruction instruction, const Variant& L, Variant& R)
+{
+	switch (instruction)
+	{
+	case Instruction::Add:
+	{
+		if (AnyString(L, R))
+			R = Variant(L.Get<String>() + R.Get<String>());
+		else
+			R = ToNumber(L) + ToNumber(R);
+	}
+	break;
+	case Instruction::Subtract:  R = ToNumber(L) - ToNumber(R);  break;
+	case Instruction::Multiply:  R = ToNumber(L) * ToNumber(R);  break;
+	case Instruction::Divide:    R = ToNumber(L) / ToNumber(R);  break;
+	case Instruction::Not:       R = !ToBool(R);                 break;
+	case Instruction::And:       R = ToBool(L) && ToBool(R);     break;
+	case Instruction::Or:        R = ToBool(L) || ToBool(R);     break;
+	case Instruction::Less:      R = ToNumber(L) < ToNumber(R);  break;
+	case Instruction::LessEq:    R = ToNumber(L) <= ToNumber(R); break;
+	case Instruction::Greater:   R = ToNumber(L) > ToNumber(R);  break;
+	case Instruction::GreaterEq: R = ToNumber(L) >= ToNumber(R); break;
+	case Instruction::Equal:
+	{
+		if (AnyString(L, R))
+			R = (L.Get<String>() == R.Get<String>());
+		else
+			R = (ToNumber(L) == ToNumber(R));
+	}
+	break;
+	case Instruction::NotEqual:
+	{
+		if (AnyString(L, R))
+			R = (L.Get<String>() != R.Get<String>());
+		else
+			R = (ToNumber(L) != ToNumber(R));
+	}
+	break;
+	default:
+		RMLUI_ERRORMSG("Not an operator instruction.");
+		break;
+	}
+}
+
+static inline bool IsEventAddress(const DataAddress& address)
+{
+	return address.size() == 2 && address.front().name == "ev";
+}
+
 namespace Parse {
 	static void Assignment(DataParser& parser);
 	static void Expression(DataParser& parser);
@@ -163,8 +226,9 @@ public:
 
 	bool Parse(bool is_assignment_expression)
 	{
-		program.clear();
+		program = Program();
 		variable_addresses.clear();
+		program_stack_size = 0;
 		index = 0;
 		reached_end = false;
 		parse_error = false;
@@ -204,11 +268,21 @@ public:
 		RMLUI_ASSERTMSG(instruction != Instruction::Push && instruction != Instruction::Pop &&
 			instruction != Instruction::Arguments && instruction != Instruction::Variable && instruction != Instruction::Assign,
 			"Use the Push(), Pop(), Arguments(), Variable(), and Assign() procedures for stack manipulation and variable instructions.");
-		program.push_back(InstructionData{ instruction, std::move(data) });
+
+		if (instruction == Instruction::Literal || instruction == Instruction::TransformFnc || instruction == Instruction::EventFnc)
+		{
+			program.instructions.push_back(InstructionData{ instruction, int(program.literals.size()) });
+			program.literals.push_back(std::move(data));
+		}
+		else if (!FoldConstants(instruction))
+		{
+			program.instructions.push_back(InstructionData{ instruction, 0 });
+		}
 	}
 	void Push() {
 		program_stack_size += 1;
-		program.push_back(InstructionData{ Instruction::Push, Variant() });
+		program.stack_size = Math::Max(program.stack_size, program_stack_size);
+		program.instructions.push_back(InstructionData{ Instruction::Push, 0 });
 	}
 	void Pop(Register destination) {
 		if (program_stack_size <= 0) {
@@ -216,7 +290,7 @@ public:
 			return;
 		}
 		program_stack_size -= 1;
-		program.push_back(InstructionData{ Instruction::Pop, Variant(int(destination)) });
+		program.instructions.push_back(InstructionData{ Instruction::Pop, int(destination) });
 	}
 	void Arguments(int num_arguments) {
 		if (program_stack_size < num_arguments) {
@@ -224,7 +298,7 @@ public:
 			return;
 		}
 		program_stack_size -= num_arguments;
-		program.push_back(InstructionData{ Instruction::Arguments, Variant(int(num_arguments)) });
+		program.instructions.push_back(InstructionData{ Instruction::Arguments, num_arguments });
 	}
 	void Variable(const String& name) {
 		VariableGetSet(name, false);
@@ -234,6 +308,68 @@ public:
 	}
 
 private:
+	// Replaces operators acting only on literals by the resulting literal. Operators are emitted after their operands have
+	// been moved into the registers, thus the operands are found at the end of the program.
+	bool FoldConstants(Instruction instruction)
+	{
+		Vector<InstructionData>& instructions = program.instructions;
+		const size_t num_instructions = instructions.size();
+
+		auto Matches = [&](size_t offset_from_end, Instruction match_instruction, int match_data = -1) {
+			if (offset_from_end > num_instructions)
+				return false;
+			const InstructionData& data = instructions[num_instructions - offset_from_end];
+			return data.instruction == match_instruction && (match_data < 0 || data.data == match_data);
+		};
+		auto LiteralAt = [&](size_t offset_from_end) -> Variant& {
+			return program.literals[instructions[num_instructions - offset_from_end].data];
+		};
+		// The operands are always the most recently added literals, erase them along with their instructions.
+		auto EraseInstructions = [&](size_t count, size_t num_literals) {
+			instructions.resize(num_instructions - count);
+			program.literals.resize(program.literals.size() - num_literals);
+		};
+
+		switch (instruction)
+		{
+		case Instruction::Not:
+		{
+			// Literal(R)
+			if (!Matches(1, Instruction::Literal))
+				return false;
+			ExecuteOperator(instruction, Variant(), LiteralAt(1));
+			return true;
+		}
+		case Instruction::Ternary:
+		{
+			// Literal(L), Push, Literal(C), Push, Literal(R), Pop(C), Pop(L)
+			if (!Matches(7, Instruction::Literal) || !Matches(6, Instruction::Push) || !Matches(5, Instruction::Literal) || !Matches(4, Instruction::Push) ||
+				!Matches(3, Instruction::Literal) || !Matches(2, Instruction::Pop, int(Register::C)) || !Matches(1, Instruction::Pop, int(Register::L)))
+				return false;
+			Variant& result = LiteralAt(7);
+			result = std::move(ToBool(result) ? LiteralAt(5) : LiteralAt(3));
+			EraseInstructions(6, 2);
+			return true;
+		}
+		case Instruction::TransformFnc:
+		case Instruction::EventFnc:
+			return false;
+		default:
+		{
+			// Literal(L), Push, Literal(R), Pop(L)
+			if (!Matches(4, Instruction::Literal) || !Matches(3, Instruction::Push) || !Matches(2, Instruction::Literal) ||
+				!Matches(1, Instruction::Pop, int(Register::L)))
+				return false;
+			Variant& result = LiteralAt(4);
+			Variant right = std::move(LiteralAt(2));
+			ExecuteOperator(instruction, result, right);
+			result = std::move(right);
+			EraseInstructions(3, 1);
+			return true;
+		}
+		}
+	}
+
 	void VariableGetSet(const String& name, bool is_assignment)
 	{
 		DataAddress address = expression_interface.ParseAddress(name);
@@ -243,7 +379,7 @@ private:
 		}
 		int index = int(variable_addresses.size());
 		variable_addresses.push_back(std::move(address));
-		program.push_back(InstructionData{ is_assignment ? Instruction::Assign : Instruction::Variable, Variant(int(index)) });
+		program.instructions.push_back(InstructionData{ is_assignment ? Instruction::Assign : Instruction::Variable, index });
 	}
 
 	const String expression;
@@ -752,8 +888,15 @@ namespace Parse {
 
 class DataInterpreter {
 public:
-	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface)
-		: program(program), addresses(addresses), expression_interface(expression_interface) {}
+	// The variable slots optionally contain the resolved top-level variable for each address, or an empty variable where the
+	// address needs to be resolved in full.
+	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface,
+		const Vector<DataVariable>* variable_slots = nullptr)
+		: program(program), addresses(addresses), expression_interface(expression_interface), variable_slots(variable_slots)
+	{
+		RMLUI_ASSERT(!variable_slots || variable_slots->size() == addresses.size());
+		stack.reserve(program.stack_size);
+	}
 
 	bool Error(String message) const
 	{
@@ -766,9 +909,9 @@ public:
 	bool Run()
 	{
 		bool success = true;
-		for (size_t i = 0; i < program.size(); i++)
+		for (const InstructionData& instruction_data : program.instructions)
 		{
-			if (!Execute(program[i].instruction, program[i].data))
+			if (!Execute(instruction_data.instruction, instruction_data.data))
 			{
 				success = false;
 				break;
@@ -781,7 +924,7 @@ public:
 		if(!success)
 		{
 			String program_str = DumpProgram();
-			Log::Message(Log::LT_WARNING, "Failed to execute program with %zu instructions:", program.size());
+			Log::Message(Log::LT_WARNING, "Failed to execute program with %zu instructions:", program.instructions.size());
 			Log::Message(Log::LT_WARNING, "%s", program_str.c_str());
 		}
 
@@ -791,39 +934,51 @@ public:
 	String DumpProgram() const
 	{
 		String str;
-		for (size_t i = 0; i < program.size(); i++)
+		for (size_t i = 0; i < program.instructions.size(); i++)
 		{
-			String instruction_str = program[i].data.Get<String>();
-			str += CreateString(50 + instruction_str.size(), "  %4zu  '%c'  %s\n", i, char(program[i].instruction), instruction_str.c_str());
+			const InstructionData& instruction_data = program.instructions[i];
+			String instruction_str;
+			switch (instruction_data.instruction)
+			{
+			case Instruction::Literal:
+			case Instruction::TransformFnc:
+			case Instruction::EventFnc:
+				instruction_str = program.literals[instruction_data.data].Get<String>();
+				break;
+			default:
+				instruction_str = ToString(instruction_data.data);
+				break;
+			}
+			str += CreateString(50 + instruction_str.size(), "  %4zu  '%c'  %s\n", i, char(instruction_data.instruction), instruction_str.c_str());
 		}
 		return str;
 	}
 
-	Variant Result() const {
+	const Variant& Result() const {
 		return R;
 	}
+	Variant ReleaseResult() {
+		return std::move(R);
+	}
 
 
 private:
 	Variant R, L, C;
-	Stack<Variant> stack;
+	Vector<Variant> stack;
 	Vector<Variant> arguments;
 
 	const Program& program;
 	const AddressList& addresses;
 	DataExpressionInterface expression_interface;
+	const Vector<DataVariable>* variable_slots;
 
-	bool Execute(const Instruction instruction, const Variant& data)
+	bool Execute(const Instruction instruction, const int data)
 	{
-		auto AnyString = [](const Variant& v1, const Variant& v2) {
-			return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING;
-		};
-
 		switch (instruction)
 		{
 		case Instruction::Push:
 		{
-			stack.push(std::move(R));
+			stack.push_back(std::move(R));
 			R.Clear();
 		}
 		break;
@@ -832,11 +987,11 @@ private:
 			if (stack.empty())
 				return Error("Cannot pop stack, it is empty.");
 
-			Register reg = Register(data.Get<int>(-1));
+			Register reg = Register(data);
 			switch (reg) {
-			case Register::R:  R = stack.top(); stack.pop(); break;
-			case Register::L:  L = stack.top(); stack.pop(); break;
-			case Register::C:  C = stack.top(); stack.pop(); break;
+			case Register::R:  R = std::move(stack.back()); stack.pop_back(); break;
+			case Register::L:  L = std::move(stack.back()); stack.pop_back(); break;
+			case Register::C:  C = std::move(stack.back()); stack.pop_back(); break;
 			default:
 				return Error(CreateString(50, "Invalid register %d.", int(reg)));
 			}
@@ -844,56 +999,42 @@ private:
 		break;
 		case Instruction::Literal:
 		{
-			R = data;
+			R = program.literals[data];
 		}
 		break;
 		case Instruction::Variable:
 		{
-			size_t variable_index = size_t(data.Get<int>(-1));
-			if (variable_index < addresses.size())
-				R = expression_interface.GetValue(addresses[variable_index]);
-			else
+			size_t variable_index = size_t(data);
+			if (variable_index >= addresses.size())
 				return Error("Variable address not found.");
-		}
-		break;
-		case Instruction::Add:
-		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() + R.Get<String>());
+
+			if (variable_slots && (*variable_slots)[variable_index])
+				R = expression_interface.GetValue(addresses[variable_index], (*variable_slots)[variable_index]);
 			else
-				R = Variant(L.Get<double>() + R.Get<double>());
+				R = expression_interface.GetValue(addresses[variable_index]);
 		}
 		break;
-		case Instruction::Subtract:  R = Variant(L.Get<double>() - R.Get<double>());  break;
-		case Instruction::Multiply:  R = Variant(L.Get<double>() * R.Get<double>());  break;
-		case Instruction::Divide:    R = Variant(L.Get<double>() / R.Get<double>());  break;
-		case Instruction::Not:       R = Variant(!R.Get<bool>());                     break;
-		case Instruction::And:       R = Variant(L.Get<bool>() && R.Get<bool>());     break;
-		case Instruction::Or:        R = Variant(L.Get<bool>() || R.Get<bool>());     break;
-		case Instruction::Less:      R = Variant(L.Get<double>() < R.Get<double>());  break;
-		case Instruction::LessEq:    R = Variant(L.Get<double>() <= R.Get<double>()); break;
-		case Instruction::Greater:   R = Variant(L.Get<double>() > R.Get<double>());  break;
-		case Instruction::GreaterEq: R = Variant(L.Get<double>() >= R.Get<double>()); break;
+		case Instruction::Add:
+		case Instruction::Subtract:
+		case Instruction::Multiply:
+		case Instruction::Divide:
+		case Instruction::Not:
+		case Instruction::And:
+		case Instruction::Or:
+		case Instruction::Less:
+		case Instruction::LessEq:
+		case Instruction::Greater:
+		case Instruction::GreaterEq:
 		case Instruction::Equal:
-		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() == R.Get<String>());
-			else
-				R = Variant(L.Get<double>() == R.Get<double>());
-		}
-		break;
 		case Instruction::NotEqual:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() != R.Get<String>());
-			else
-				R = Variant(L.Get<double>() != R.Get<double>());
+			ExecuteOperator(instruction, L, R);
 		}
 		break;
 		case Instruction::Ternary:
 		{
-			if (L.Get<bool>())
-				R = C;
+			if (ToBool(L))
+				R = std::move(C);
 		}
 		break;
 		case Instruction::Arguments:
@@ -901,7 +1042,7 @@ private:
 			if (!arguments.empty())
 				return Error("Argument stack is not empty.");
 
-			int num_arguments = data.Get<int>(-1);
+			int num_arguments = data;
 			if (num_arguments < 0)
 				return Error("Invalid number of arguments.");
 			if (stack.size() < size_t(num_arguments))
@@ -910,14 +1051,14 @@ private:
 			arguments.resize(num_arguments);
 			for (int i = num_arguments - 1; i >= 0; i--)
 			{
-				arguments[i] = std::move(stack.top());
-				stack.pop();
+				arguments[i] = std::move(stack.back());
+				stack.pop_back();
 			}
 		}
 		break;
 		case Instruction::TransformFnc:
 		{
-			const String function_name = data.Get<String>();
+			const String& function_name = program.literals[data].GetReference<String>();
 			
 			if (!expression_interface.CallTransform(function_name, R, arguments))
 			{
@@ -936,7 +1077,7 @@ private:
 		break;
 		case Instruction::EventFnc:
 		{
-			const String function_name = data.Get<String>();
+			const String& function_name = program.literals[data].GetReference<String>();
 
 			if (!expression_interface.EventCallback(function_name, arguments))
 			{
@@ -955,7 +1096,7 @@ private:
 		break;
 		case Instruction::Assign:
 		{
-			size_t variable_index = size_t(data.Get<int>(-1));
+			size_t variable_index = size_t(data);
 			if (variable_index < addresses.size())
 			{
 				if (!expression_interface.SetValue(addresses[variable_index], R))
@@ -993,15 +1134,36 @@ bool DataExpression::Parse(const DataExpressionInterface& expression_interface,
 
 bool DataExpression::Run(const DataExpressionInterface& expression_interface, Variant& out_value)
 {
-	DataInterpreter interpreter(program, addresses, expression_interface);
+	UpdateVariableSlots(expression_interface.GetDataModel());
+
+	DataInterpreter interpreter(program, addresses, expression_interface, &variable_slots);
 	
 	if (!interpreter.Run())
 		return false;
 
-	out_value = interpreter.Result();
+	out_value = interpreter.ReleaseResult();
 	return true;
 }
 
+void DataExpression::UpdateVariableSlots(const DataModel* data_model)
+{
+	const int generation = (data_model ? data_model->GetVariableGeneration() : -1);
+	if (data_model == variable_slots_model && generation == variable_slots_generation && variable_slots.size() == addresses.size())
+		return;
+
+	variable_slots_model = data_model;
+	variable_slots_generation = generation;
+
+	// Event parameters are looked up at run time, and can not be resolved in advance.
+	variable_slots.resize(addresses.size());
+	for (size_t i = 0; i < addresses.size(); i++)
+	{
+		const DataAddress& address = addresses[i];
+		const bool resolve = (data_model && !address.empty() && !IsEventAddress(address));
+		variable_slots[i] = (resolve ? data_model->GetTopLevelVariable(address.front().name) : DataVariable());
+	}
+}
+
 StringList DataExpression::GetVariableNameList() const
 {
 	StringList list;
@@ -1027,7 +1189,7 @@ DataAddress DataExpressionInterface::ParseAddress(const String& address_str) con
 Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 {
 	Variant result;
-	if(event && address.size() == 2 && address.front().name == "ev")
+	if(event && IsEventAddress(address))
 	{
 		auto& parameters = event->GetParameters();
 		auto it = parameters.find(address.back().name);
@@ -1041,6 +1203,14 @@ Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 	return result;
 }
 
+Variant DataExpressionInterface::GetValue(const DataAddress& address, DataVariable top_level_variable) const
+{
+	Variant result;
+	if (data_model)
+		data_model->GetVariableInto(top_level_variable, address, result);
+	return result;
+}
+
 bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant& value) const
 {
 	bool result = false;
@@ -32,15 +32,23 @@
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "../../Include/RmlUi/Core/DataVariable.h"
 
 namespace Rml {
 
 class Element;
 class DataModel;
 struct InstructionData;
-using Program = Vector<InstructionData>;
 using AddressList = Vector<DataAddress>;
 
+struct Program {
+	Vector<InstructionData> instructions;
+	// Literal values and function names referenced by the instructions.
+	VariantList literals;
+	// The maximum size of the program stack during execution.
+	int stack_size = 0;
+};
+
 class DataExpressionInterface {
 public:
     DataExpressionInterface() = default;
@@ -48,10 +56,14 @@ public:
 
     DataAddress ParseAddress(const String& address_str) const;
     Variant GetValue(const DataAddress& address) const;
+    // Gets the value of the address starting from its already resolved top-level variable.
+    Variant GetValue(const DataAddress& address, DataVariable top_level_variable) const;
     bool SetValue(const DataAddress& address, const Variant& value) const;
     bool CallTransform(const String& name, Variant& inout_result, const VariantList& arguments);
     bool EventCallback(const String& name, const VariantList& arguments);
 
+    DataModel* GetDataModel() const { return data_model; }
+
 private:
     DataModel* data_model = nullptr;
     Element* element = nullptr;
@@ -70,12 +82,20 @@ public:
 
     // Available after Parse()
     StringList GetVariableNameList() const;
+    const AddressList& GetVariableAddressList() const { return addresses; }
 
 private:
+    void UpdateVariableSlots(const DataModel* data_model);
+
     String expression;
     
     Program program;
     AddressList addresses;
+
+    // The top-level variables of each address, resolved on the first run and whenever the model binds new variables.
+    Vector<DataVariable> variable_slots;
+    const DataModel* variable_slots_model = nullptr;
+    int variable_slots_generation = -1;
 };
 
 } // namespace Rml
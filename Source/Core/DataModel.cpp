@@ -75,6 +75,11 @@ static DataAddress ParseAddress(const String& address_str)
 	return address;
 }
 
+// Iterator slot entries are the only address entries with both a name and an index, the name cannot be parsed from an address.
+static const String iterator_slot_name = "#iterator";
+static const String iterator_slot_index_name = "#iterator_index";
+
+
 // Returns an error string on error, or nullptr on success.
 static const char* LegalVariableName(const String& name)
 {
@@ -161,6 +166,8 @@ bool DataModel::BindVariable(const String& name, DataVariable variable)
 		return false;
 	}
 
+	variable_generation += 1;
+
 	return true;
 }
 
@@ -229,9 +236,62 @@ bool DataModel::InsertAlias(Element* element, const String& alias_name, DataAddr
 
 bool DataModel::EraseAliases(Element* element)
 {
+	auto it_slot = element_iterator_slots.find(element);
+	if (it_slot != element_iterator_slots.end())
+	{
+		free_iterator_slots.push_back(it_slot->second);
+		element_iterator_slots.erase(it_slot);
+	}
+
 	return aliases.erase(element) == 1;
 }
 
+int DataModel::InsertIteratorSlot(Element* element, int index)
+{
+	RMLUI_ASSERTMSG(element_iterator_slots.count(element) == 0, "Only a single iterator slot can be owned by each element.");
+
+	int slot = 0;
+	if (free_iterator_slots.empty())
+	{
+		slot = (int)iterator_slots.size();
+		iterator_slots.push_back(index);
+	}
+	else
+	{
+		slot = free_iterator_slots.back();
+		free_iterator_slots.pop_back();
+		iterator_slots[slot] = index;
+	}
+
+	element_iterator_slots[element] = slot;
+	return slot;
+}
+
+void DataModel::SetIteratorSlot(int slot, int index)
+{
+	RMLUI_ASSERT(slot >= 0 && slot < (int)iterator_slots.size());
+	iterator_slots[slot] = index;
+}
+
+DataAddressEntry DataModel::MakeIteratorSlotEntry(int slot)
+{
+	DataAddressEntry entry(iterator_slot_name);
+	entry.index = slot;
+	return entry;
+}
+
+DataAddressEntry DataModel::MakeIteratorSlotIndexEntry(int slot)
+{
+	DataAddressEntry entry(iterator_slot_index_name);
+	entry.index = slot;
+	return entry;
+}
+
+bool DataModel::IsIteratorSlotEntry(const DataAddressEntry& entry)
+{
+	return entry.index >= 0 && !entry.name.empty();
+}
+
 DataAddress DataModel::ResolveAddress(const String& address_str, Element* element) const
 {
 	DataAddress address = ParseAddress(address_str);
@@ -286,18 +346,7 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 
 	auto it = variables.find(address.front().name);
 	if (it != variables.end())
-	{
-		DataVariable variable = it->second;
-
-		for (int i = 1; i < (int)address.size() && variable; i++)
-		{
-			variable = variable.Child(address[i]);
-			if (!variable)
-				return DataVariable();
-		}
-
-		return variable;
-	}
+		return GetVariable(it->second, address);
 
 	if (address[0].name == "literal")
 	{
@@ -308,6 +357,40 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 	return DataVariable();
 }
 
+DataVariable DataModel::GetTopLevelVariable(const String& name) const
+{
+	auto it = variables.find(name);
+	if (it != variables.end())
+		return it->second;
+	return DataVariable();
+}
+
+DataVariable DataModel::GetVariable(DataVariable top_level_variable, const DataAddress& address) const
+{
+	DataVariable variable = top_level_variable;
+
+	for (int i = 1; i < (int)address.size() && variable; i++)
+	{
+		const DataAddressEntry& entry = address[i];
+		if (IsIteratorSlotEntry(entry))
+		{
+			const int index = iterator_slots[entry.index];
+			if (entry.name == iterator_slot_index_name)
+				return (i + 1 == (int)address.size() ? MakeLiteralIntVariable(index) : DataVariable());
+			variable = variable.Child(DataAddressEntry(index));
+		}
+		else
+		{
+			variable = variable.Child(entry);
+		}
+
+		if (!variable)
+			return DataVariable();
+	}
+
+	return variable;
+}
+
 const DataEventFunc* DataModel::GetEventCallback(const String& name)
 {
 	auto it = event_callbacks.find(name);
@@ -328,6 +411,14 @@ bool DataModel::GetVariableInto(const DataAddress& address, Variant& out_value)
 	return result;
 }
 
+bool DataModel::GetVariableInto(DataVariable top_level_variable, const DataAddress& address, Variant& out_value) const {
+	DataVariable variable = GetVariable(top_level_variable, address);
+	bool result = (variable && variable.Get(out_value));
+	if (!result)
+		Log::Message(Log::LT_WARNING, "Could not get value from data variable '%s'.", DataAddressToString(address).c_str());
+	return result;
+}
+
 void DataModel::DirtyVariable(const String& variable_name)
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
@@ -341,6 +432,39 @@ bool DataModel::IsVariableDirty(const String& variable_name) const
 	return dirty_variables.count(variable_name) == 1;
 }
 
+void DataModel::DirtyAddress(const DataAddress& address)
+{
+	if (address.empty())
+		return;
+
+	if (address.size() == 1)
+	{
+		DirtyVariable(address.front().name);
+		return;
+	}
+
+	// Iterator slots are replaced by their current index. The slot's index entry can't be dirtied on its own, instead its
+	// container item is dirtied.
+	DataAddress resolved_address;
+	resolved_address.reserve(address.size());
+	for (const DataAddressEntry& entry : address)
+	{
+		if (!IsIteratorSlotEntry(entry))
+			resolved_address.push_back(entry);
+		else if (entry.name == iterator_slot_name)
+			resolved_address.push_back(DataAddressEntry(iterator_slots[entry.index]));
+	}
+
+	dirty_addresses.insert(DataViews::CreateAddressKey(resolved_address));
+}
+
+void DataModel::DirtyAddress(const String& address_str)
+{
+	DataAddress address = ParseAddress(address_str);
+	RMLUI_ASSERTMSG(!address.empty() && variables.count(address.front().name) == 1, "In DirtyAddress: Variable name not found among added variables.");
+	DirtyAddress(address);
+}
+
 void DataModel::DirtyAllVariables() {
 	dirty_variables.reserve(variables.size());
 	for (const auto& variable : variables) {
@@ -375,10 +499,13 @@ void DataModel::OnElementRemove(Element* element)
 
 bool DataModel::Update(bool clear_dirty_variables)
 {
-	const bool result = views->Update(*this, dirty_variables);
+	const bool result = views->Update(*this, dirty_variables, dirty_addresses);
 
 	if (clear_dirty_variables)
+	{
 		dirty_variables.clear();
+		dirty_addresses.clear();
+	}
 	
 	return result;
 }
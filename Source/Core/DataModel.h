@@ -60,15 +60,36 @@ public:
 	bool InsertAlias(Element* element, const String& alias_name, DataAddress replace_with_address);
 	bool EraseAliases(Element* element);
 
+	// Iterator slots hold the current container index of an iteration, owned by the given element and erased with its aliases.
+	// Aliases can address the slot in place of a fixed index, which lets keyed 'data-for' views move an element to another
+	// iteration without rebinding its data views and controllers.
+	int InsertIteratorSlot(Element* element, int index);
+	void SetIteratorSlot(int slot, int index);
+	// Address entry which selects the container item at the slot's current index.
+	static DataAddressEntry MakeIteratorSlotEntry(int slot);
+	// Address entry which evaluates to the slot's current index, must be the last entry of the address.
+	static DataAddressEntry MakeIteratorSlotIndexEntry(int slot);
+	static bool IsIteratorSlotEntry(const DataAddressEntry& entry);
+
 	DataAddress ResolveAddress(const String& address_str, Element* element) const;
 	const DataEventFunc* GetEventCallback(const String& name);
 
 	DataVariable GetVariable(const DataAddress& address) const;
 	bool GetVariableInto(const DataAddress& address, Variant& out_value) const;
 
+	// Top-level variables can be resolved once and reused by their users, until the variable generation changes.
+	DataVariable GetTopLevelVariable(const String& name) const;
+	int GetVariableGeneration() const { return variable_generation; }
+	// Resolves the address starting from its already resolved top-level variable.
+	DataVariable GetVariable(DataVariable top_level_variable, const DataAddress& address) const;
+	bool GetVariableInto(DataVariable top_level_variable, const DataAddress& address, Variant& out_value) const;
+
 	void DirtyVariable(const String& variable_name);
 	bool IsVariableDirty(const String& variable_name) const;
 	void DirtyAllVariables();
+	// Dirties only the views depending on the given address, any part of it, or any address it is a part of.
+	void DirtyAddress(const DataAddress& address);
+	void DirtyAddress(const String& address_str);
 
 	bool CallTransform(const String& name, Variant& inout_result, const VariantList& arguments) const;
 
@@ -86,6 +107,9 @@ private:
 
 	UnorderedMap<String, DataVariable> variables;
 	DirtyVariables dirty_variables;
+	// Keys of the dirty addresses, see DataViews::CreateAddressKey().
+	DirtyVariables dirty_addresses;
+	int variable_generation = 0;
 
 	UnorderedMap<String, UniquePtr<FuncDefinition>> function_variable_definitions;
 	UnorderedMap<String, DataEventFunc> event_callbacks;
@@ -93,6 +117,10 @@ private:
 	using ScopedAliases = UnorderedMap<Element*, SmallUnorderedMap<String, DataAddress>>;
 	ScopedAliases aliases;
 
+	Vector<int> iterator_slots;
+	Vector<int> free_iterator_slots;
+	UnorderedMap<Element*, int> element_iterator_slots;
+
 	const TransformFuncRegister* transform_register;
 
 	SmallUnorderedSet<Element*> attached_elements;
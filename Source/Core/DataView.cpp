@@ -28,6 +28,7 @@
 
 #include "DataView.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "DataModel.h"
 #include <algorithm>
 
 namespace Rml {
@@ -51,6 +52,14 @@ bool DataView::IsValid() const {
 	return static_cast<bool>(attached_element);
 }
 
+Vector<DataAddress> DataView::GetVariableAddressList() const
+{
+	Vector<DataAddress> addresses;
+	for (String& name : GetVariableNameList())
+		addresses.push_back(DataAddress{ DataAddressEntry(std::move(name)) });
+	return addresses;
+}
+
 DataView::DataView(Element* element, int bias) : attached_element(element->GetObserverPtr()), sort_order(bias + 1000) {
 	RMLUI_ASSERT(bias >= -1000 && bias <= 999);
 
@@ -87,17 +96,81 @@ void DataViews::OnElementRemove(Element* element)
 	}
 }
 
-bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
+String DataViews::CreateAddressKey(const DataAddress& address)
+{
+	String key;
+	for (const DataAddressEntry& entry : address)
+	{
+		if (DataModel::IsIteratorSlotEntry(entry))
+			break;
+
+		if (entry.index >= 0)
+			key += '[' + ToString(entry.index) + ']';
+		else
+		{
+			if (!key.empty())
+				key += '.';
+			key += entry.name;
+		}
+	}
+	return key;
+}
+
+void DataViews::AddDependencies(DataView* view)
+{
+	for (const DataAddress& address : view->GetVariableAddressList())
+	{
+		const String key = CreateAddressKey(address);
+		if (key.empty())
+			continue;
+
+		address_view_map.emplace(key, view);
+
+		for (size_t i = 1; i < key.size(); i++)
+		{
+			if (key[i] == '.' || key[i] == '[')
+				address_prefix_view_map.emplace(key.substr(0, i), view);
+		}
+	}
+}
+
+void DataViews::CollectDirtyViews(const String& address_key, Vector<DataView*>& dirty_views) const
+{
+	auto AddViews = [&dirty_views](const AddressViewMap& map, const String& key) {
+		auto pair = map.equal_range(key);
+		for (auto it = pair.first; it != pair.second; ++it)
+			dirty_views.push_back(it->second);
+	};
+
+	// Views depending on the address itself, or on any address it is a part of.
+	for (size_t i = 1; i < address_key.size(); i++)
+	{
+		if (address_key[i] == '.' || address_key[i] == '[')
+			AddViews(address_view_map, address_key.substr(0, i));
+	}
+	AddViews(address_view_map, address_key);
+
+	// Views depending on any part of the address.
+	AddViews(address_prefix_view_map, address_key);
+}
+
+bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables, const DirtyVariables& dirty_addresses)
 {
 	bool result = false;
 	size_t num_dirty_variables_prev = 0;
+	size_t num_dirty_addresses_prev = 0;
+
+	auto HasNewViewsOrDirtyVariables = [&]() {
+		return !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size() || num_dirty_addresses_prev != dirty_addresses.size();
+	};
 
 	// View updates may result in newly added views, or even new dirty variables. Thus, we do the
 	// update recursively but with an upper limit. Without the loop, newly added views won't be
 	// updated until the next Update() call.
-	for(int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size()) && i < 10; i++)
+	for(int i = 0; (i == 0 || HasNewViewsOrDirtyVariables()) && i < 10; i++)
 	{
 		num_dirty_variables_prev = dirty_variables.size();
+		num_dirty_addresses_prev = dirty_addresses.size();
 
 		Vector<DataView*> dirty_views;
 
@@ -107,8 +180,7 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 			for (auto&& view : views_to_add)
 			{
 				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
+				AddDependencies(view.get());
 
 				views.push_back(std::move(view));
 			}
@@ -116,10 +188,17 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 		}
 
 		for (const String& variable_name : dirty_variables)
+			CollectDirtyViews(variable_name, dirty_views);
+
+		for (const String& address_key : dirty_addresses)
 		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
+			if (!dirty_variables.empty())
+			{
+				const size_t name_end = address_key.find_first_of(".[");
+				if (dirty_variables.count(address_key.substr(0, name_end)) == 1)
+					continue;
+			}
+			CollectDirtyViews(address_key, dirty_views);
 		}
 
 		// Remove duplicate entries
@@ -142,15 +221,19 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 		}
 
 		// Destroy views marked for destruction
-		// @performance: Horrible...
 		if (!views_to_remove.empty())
 		{
+			UnorderedSet<DataView*> removed_views;
+			removed_views.reserve(views_to_remove.size());
 			for (const auto& view : views_to_remove)
+				removed_views.insert(view.get());
+
+			for (AddressViewMap* map : { &address_view_map, &address_prefix_view_map })
 			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end(); )
+				for (auto it = map->begin(); it != map->end();)
 				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
+					if (removed_views.count(it->second) == 1)
+						it = map->erase(it);
 					else
 						++it;
 				}
@@ -85,6 +85,10 @@ public:
 	// Returns the list of data variable name(s) which can modify this view.
 	virtual StringList GetVariableNameList() const = 0;
 
+	// Returns the list of data addresses which can modify this view. Views returning addresses are only updated when a dirtied
+	// address overlaps with one of them, by default the view depends on every top-level variable in the name list.
+	virtual Vector<DataAddress> GetVariableAddressList() const;
+
 	// Returns the attached element if it still exists.
 	Element* GetElement() const;
 
@@ -117,7 +121,12 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
+	// Updates the views depending on any of the dirty variables, or on addresses overlapping with any of the dirty address keys.
+	bool Update(DataModel& model, const DirtyVariables& dirty_variables, const DirtyVariables& dirty_addresses);
+
+	// Returns a string uniquely identifying the address, in the form 'items[42].health'. The key ends before any iterator slot
+	// entry, since their index can change without the views being recreated.
+	static String CreateAddressKey(const DataAddress& address);
 
 private:
 	using DataViewList = Vector<DataViewPtr>;
@@ -127,8 +136,13 @@ private:
 	DataViewList views_to_add;
 	DataViewList views_to_remove;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
-	NameViewMap name_view_map;
+	void AddDependencies(DataView* view);
+	void CollectDirtyViews(const String& address_key, Vector<DataView*>& dirty_views) const;
+
+	// Views are indexed by the keys of the addresses they depend on, and separately by every proper prefix of those keys.
+	using AddressViewMap = UnorderedMultimap<String, DataView*>;
+	AddressViewMap address_view_map;
+	AddressViewMap address_prefix_view_map;
 };
 
 } // namespace Rml
@@ -29,10 +29,14 @@
 #include "DataViewDefault.h"
 #include "DataExpression.h"
 #include "DataModel.h"
+#include "DataViewForSpacer.h"
 #include "XMLParseTools.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/DataVariable.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Event.h"
+#include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
@@ -68,6 +72,11 @@ StringList DataViewCommon::GetVariableNameList() const {
 	return expression->GetVariableNameList();
 }
 
+Vector<DataAddress> DataViewCommon::GetVariableAddressList() const {
+	RMLUI_ASSERT(expression);
+	return expression->GetVariableAddressList();
+}
+
 const String& DataViewCommon::GetModifier() const {
 	return modifier;
 }
@@ -448,6 +457,18 @@ StringList DataViewText::GetVariableNameList() const
 	return full_list;
 }
 
+Vector<DataAddress> DataViewText::GetVariableAddressList() const
+{
+	Vector<DataAddress> full_list;
+	for (const DataEntry& entry : data_entries)
+	{
+		RMLUI_ASSERT(entry.data_expression);
+		const AddressList& entry_list = entry.data_expression->GetVariableAddressList();
+		full_list.insert(full_list.end(), entry_list.begin(), entry_list.end());
+	}
+	return full_list;
+}
+
 void DataViewText::Release()
 {
 	delete this;
@@ -479,9 +500,36 @@ String DataViewText::BuildText() const
 
 
 
+// Row height used by virtualized 'data-for' views before any rows have been laid out.
+static constexpr float VirtualDefaultRowHeight = 20.f;
+
+// Checks the range of items in view of a virtualized 'data-for' view when its viewport scrolls, so that the view instances the newly visible rows.
+class DataViewForScrollListener final : public EventListener {
+public:
+	DataViewForScrollListener(Element* spacer) : spacer(spacer->GetObserverPtr()) {}
+
+	void ProcessEvent(Event& event) override
+	{
+		if (event.GetTargetElement() != event.GetCurrentElement())
+			return;
+
+		if (Element* element = spacer.get())
+			static_cast<DataViewForSpacer*>(element)->CheckVisibleRange();
+	}
+
+private:
+	ObserverPtr<Element> spacer;
+};
+
 DataViewFor::DataViewFor(Element* element) : DataView(element, 0)
 {}
 
+DataViewFor::~DataViewFor()
+{
+	if (Element* scroll = scroll_element.get())
+		scroll->RemoveEventListener(EventId::Scroll, scroll_listener.get());
+}
+
 bool DataViewFor::Initialize(DataModel& model, Element* element, const String& in_expression, const String& in_rml_content)
 {
 	rml_contents = in_rml_content;
@@ -532,13 +580,49 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 
 	// Copy over the attributes, but remove the 'data-for' which would otherwise recreate the data-for loop on all constructed children recursively.
 	attributes = element->GetAttributes();
-	for (auto it = attributes.begin(); it != attributes.end(); ++it)
+	attributes.erase("data-for");
+
+	// With a key, existing elements are matched to the container items by evaluating the key expression for every item. The
+	// expression is parsed on this element, using an alias to the iterator slot which is pointed at each item in turn.
+	auto it_key = attributes.find("data-key");
+	if (it_key != attributes.end())
 	{
-		if (it->first == "data-for")
+		key_slot = model.InsertIteratorSlot(element, 0);
+
+		DataAddress key_iterator_address = container_address;
+		key_iterator_address.push_back(DataModel::MakeIteratorSlotEntry(key_slot));
+		DataAddress key_iterator_index_address = container_address;
+		key_iterator_index_address.push_back(DataModel::MakeIteratorSlotIndexEntry(key_slot));
+
+		model.InsertAlias(element, iterator_name, std::move(key_iterator_address));
+		model.InsertAlias(element, iterator_index_name, std::move(key_iterator_index_address));
+
+		key_expression = MakeUnique<DataExpression>(it_key->second.Get<String>());
+		DataExpressionInterface expression_interface(&model, element);
+		if (!key_expression->Parse(expression_interface, false))
 		{
-			attributes.erase(it);
-			break;
+			Log::Message(Log::LT_WARNING, "Invalid data-key expression '%s'", it_key->second.Get<String>().c_str());
+			return false;
 		}
+
+		attributes.erase(it_key);
+	}
+
+	auto it_virtual = attributes.find("data-virtual");
+	if (it_virtual != attributes.end())
+	{
+		Element* parent = element->GetParentNode();
+		if (!parent)
+		{
+			Log::Message(Log::LT_WARNING, "Virtualized data-for requires a parent element.");
+			return false;
+		}
+		if (key_expression)
+			Log::Message(Log::LT_WARNING, "The data-key attribute is ignored on virtualized data-for.");
+
+		virtualized = true;
+		virtual_row_height = FromString<float>(it_virtual->second.Get<String>(), 0.f);
+		attributes.erase(it_virtual);
 	}
 
 	return true;
@@ -553,6 +637,19 @@ bool DataViewFor::Update(DataModel& model)
 
 	bool result = false;
 	const int size = variable.Size();
+
+	if (virtualized)
+	{
+		UpdateVirtualized(model, size);
+		return result;
+	}
+
+	if (key_expression)
+	{
+		UpdateKeyed(model, size);
+		return result;
+	}
+
 	const int num_elements = (int)elements.size();
 	Element* element = GetElement();
 
@@ -577,7 +674,7 @@ bool DataViewFor::Update(DataModel& model)
 			Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
 			elements.push_back(new_element);
 
-			elements[i]->SetInnerRML(rml_contents);
+			rml_recording.Instance(new_element, rml_contents);
 
 			RMLUI_ASSERT(i < (int)elements.size());
 		}
@@ -595,9 +692,274 @@ bool DataViewFor::Update(DataModel& model)
 	return result;
 }
 
+void DataViewFor::UpdateKeyed(DataModel& model, const int size)
+{
+	RMLUI_ASSERT(key_expression && key_slot >= 0);
+	RMLUI_ASSERT(elements.size() == keys.size() && elements.size() == slots.size());
+
+	Element* element = GetElement();
+	Element* parent = element->GetParentNode();
+	const int num_elements = (int)elements.size();
+
+	// Evaluate the key of every item.
+	StringList new_keys(size);
+	{
+		DataExpressionInterface expression_interface(&model, element);
+		for (int i = 0; i < size; i++)
+		{
+			model.SetIteratorSlot(key_slot, i);
+			Variant key;
+			if (key_expression->Run(expression_interface, key))
+				new_keys[i] = key.Get<String>();
+		}
+	}
+
+	// Match the items to the existing elements by key. Elements with duplicate keys are only matched once.
+	UnorderedMap<String, int> key_element_index;
+	key_element_index.reserve(num_elements);
+	for (int j = 0; j < num_elements; j++)
+		key_element_index.emplace(keys[j], j);
+
+	ElementList new_elements(size, nullptr);
+	Vector<int> new_slots(size, -1);
+	Vector<bool> element_matched(num_elements, false);
+	bool iterations_moved = false;
+
+	for (int i = 0; i < size; i++)
+	{
+		auto it = key_element_index.find(new_keys[i]);
+		if (it == key_element_index.end() || element_matched[it->second])
+			continue;
+
+		const int j = it->second;
+		element_matched[j] = true;
+		new_elements[i] = elements[j];
+		new_slots[i] = slots[j];
+
+		// Point the element's aliases to its new iteration, its data views are updated along with the container.
+		if (i != j)
+		{
+			model.SetIteratorSlot(slots[j], i);
+			iterations_moved = true;
+		}
+	}
+
+	// Remove the elements whose keys no longer exist.
+	ElementList current_order;
+	current_order.reserve(size);
+	for (int j = 0; j < num_elements; j++)
+	{
+		if (element_matched[j])
+		{
+			current_order.push_back(elements[j]);
+		}
+		else
+		{
+			model.EraseAliases(elements[j]);
+			parent->RemoveChild(elements[j]).reset();
+		}
+	}
+
+	// Instance elements for new items, they are placed after the existing ones and moved into position below.
+	for (int i = 0; i < size; i++)
+	{
+		if (new_elements[i])
+			continue;
+
+		ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+		const int slot = model.InsertIteratorSlot(new_element_ptr.get(), i);
+
+		DataAddress iterator_address = container_address;
+		iterator_address.push_back(DataModel::MakeIteratorSlotEntry(slot));
+		DataAddress iterator_index_address = container_address;
+		iterator_index_address.push_back(DataModel::MakeIteratorSlotIndexEntry(slot));
+
+		model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
+		model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
+
+		Element* new_element = parent->InsertBefore(std::move(new_element_ptr), element);
+		rml_recording.Instance(new_element, rml_contents);
+
+		new_elements[i] = new_element;
+		new_slots[i] = slot;
+		current_order.push_back(new_element);
+	}
+
+	if (current_order != new_elements)
+		parent->ReorderChildren(new_elements);
+
+	// The data views of moved elements are normally updated because the container is dirty. This is not the case when only
+	// variables used by the key expression changed, dirty the container to make sure they see their new iteration.
+	const String& container_name = container_address.front().name;
+	if (iterations_moved && !model.IsVariableDirty(container_name))
+		model.DirtyVariable(container_name);
+
+	elements = std::move(new_elements);
+	keys = std::move(new_keys);
+	slots = std::move(new_slots);
+}
+
+void DataViewFor::UpdateVirtualized(DataModel& model, const int size)
+{
+	RMLUI_ASSERT(elements.size() == slots.size());
+
+	Element* element = GetElement();
+	Element* parent = element->GetParentNode();
+
+	if (!spacer_before || !spacer_after)
+	{
+		for (ObserverPtr<Element>* spacer : {&spacer_before, &spacer_after})
+		{
+			ElementPtr spacer_ptr = DataViewForSpacer::Create();
+			spacer_ptr->SetProperty(PropertyId::Display, Property(Style::Display::Block));
+			spacer_ptr->SetProperty(PropertyId::Height, Property(0.f, Property::PX));
+			*spacer = parent->InsertBefore(std::move(spacer_ptr), element)->GetObserverPtr();
+		}
+
+		// The parent is the scrolling viewport.
+		scroll_listener = MakeUnique<DataViewForScrollListener>(spacer_before.get());
+		scroll_element = parent->GetObserverPtr();
+		parent->AddEventListener(EventId::Scroll, scroll_listener.get());
+	}
+
+	// The spacer in front of the items tracks the range of items within the viewport.
+	DataViewForSpacer* before = static_cast<DataViewForSpacer*>(spacer_before.get());
+	Element* after = spacer_after.get();
+
+	const float row_height = GetVirtualRowHeight();
+	int first = 0, last = 0;
+	before->GetVisibleRange(size, row_height, first, last);
+	const int count = last - first;
+
+	// Keep the elements which are still in range, and recycle the others for the items coming into view.
+	ElementList new_elements(count, nullptr);
+	Vector<int> new_slots(count, -1);
+	ElementList free_elements;
+	Vector<int> free_slots;
+
+	for (int j = 0; j < (int)elements.size(); j++)
+	{
+		const int index = first_index + j;
+		if (index >= first && index < last)
+		{
+			new_elements[index - first] = elements[j];
+			new_slots[index - first] = slots[j];
+		}
+		else
+		{
+			free_elements.push_back(elements[j]);
+			free_slots.push_back(slots[j]);
+		}
+	}
+
+	bool elements_moved = false;
+	for (int i = 0; i < count; i++)
+	{
+		if (new_elements[i])
+			continue;
+
+		if (!free_elements.empty())
+		{
+			new_elements[i] = free_elements.back();
+			new_slots[i] = free_slots.back();
+			free_elements.pop_back();
+			free_slots.pop_back();
+
+			model.SetIteratorSlot(new_slots[i], first + i);
+			elements_moved = true;
+			continue;
+		}
+
+		ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+		const int slot = model.InsertIteratorSlot(new_element_ptr.get(), first + i);
+
+		DataAddress iterator_address = container_address;
+		iterator_address.push_back(DataModel::MakeIteratorSlotEntry(slot));
+		DataAddress iterator_index_address = container_address;
+		iterator_index_address.push_back(DataModel::MakeIteratorSlotIndexEntry(slot));
+
+		model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
+		model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
+
+		Element* new_element = parent->InsertBefore(std::move(new_element_ptr), after);
+		rml_recording.Instance(new_element, rml_contents);
+
+		new_elements[i] = new_element;
+		new_slots[i] = slot;
+		elements_moved |= (first < first_index);
+	}
+
+	for (Element* free_element : free_elements)
+	{
+		model.EraseAliases(free_element);
+		parent->RemoveChild(free_element).reset();
+	}
+
+	if (elements_moved)
+		parent->ReorderChildren(new_elements);
+
+	elements = std::move(new_elements);
+	slots = std::move(new_slots);
+	first_index = first;
+	before->SetInstancedRange(container_address.front().name, size, row_height, first, last);
+
+	// Reserve the space of the items outside the range.
+	auto SetSpacerHeight = [](Element* spacer, float height) {
+		const Property* property = spacer->GetLocalProperty(PropertyId::Height);
+		if (!property || property->Get<float>() != height)
+			spacer->SetProperty(PropertyId::Height, Property(height, Property::PX));
+	};
+	SetSpacerHeight(before, float(first) * row_height);
+	SetSpacerHeight(after, float(size - last) * row_height);
+}
+
+float DataViewFor::GetVirtualRowHeight()
+{
+	if (virtual_row_height > 0.f)
+		return virtual_row_height;
+
+	// Estimate the row height from the average height of the rows which have been laid out.
+	float total_height = 0.f;
+	int num_rows = 0;
+	for (Element* row : elements)
+	{
+		const float height = row->GetBox().GetSize(Box::MARGIN).y;
+		if (height > 0.f)
+		{
+			total_height += height;
+			num_rows += 1;
+		}
+	}
+
+	if (num_rows > 0)
+		estimated_row_height = total_height / float(num_rows);
+
+	return estimated_row_height > 0.f ? estimated_row_height : VirtualDefaultRowHeight;
+}
+
 StringList DataViewFor::GetVariableNameList() const {
 	RMLUI_ASSERT(!container_address.empty());
-	return StringList{ container_address.front().name };
+	StringList variable_names = { container_address.front().name };
+	if (key_expression)
+	{
+		for (String& name : key_expression->GetVariableNameList())
+		{
+			if (std::find(variable_names.begin(), variable_names.end(), name) == variable_names.end())
+				variable_names.push_back(std::move(name));
+		}
+	}
+	return variable_names;
+}
+
+Vector<DataAddress> DataViewFor::GetVariableAddressList() const {
+	RMLUI_ASSERT(!container_address.empty());
+	Vector<DataAddress> addresses = { container_address };
+	if (key_expression)
+	{
+		const AddressList& key_addresses = key_expression->GetVariableAddressList();
+		addresses.insert(addresses.end(), key_addresses.begin(), key_addresses.end());
+	}
+	return addresses;
 }
 
 void DataViewFor::Release()
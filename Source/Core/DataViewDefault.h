@@ -33,10 +33,12 @@
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataView.h"
+#include "XMLParseRecording.h"
 
 namespace Rml {
 
 class Element;
+class EventListener;
 class DataExpression;
 using DataExpressionPtr = UniquePtr<DataExpression>;
 
@@ -48,6 +50,7 @@ public:
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
 	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
 
 protected:
 	const String& GetModifier() const;
@@ -140,6 +143,7 @@ public:
 
 	bool Update(DataModel& model) override;
 	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
 
 protected:
 	void Release() override;
@@ -161,24 +165,52 @@ private:
 class DataViewFor final : public DataView {
 public:
 	DataViewFor(Element* element);
+	~DataViewFor();
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& inner_rml) override;
 
 	bool Update(DataModel& model) override;
 
 	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
 
 protected:
 	void Release() override;
 
 private:
+	// Matches the container items to the existing elements by their key, moving elements instead of rebinding them.
+	void UpdateKeyed(DataModel& model, int size);
+	// Only instances the elements of the items within the viewport of the parent element, recycling elements which move out of view.
+	void UpdateVirtualized(DataModel& model, int size);
+	float GetVirtualRowHeight();
+
 	DataAddress container_address;
 	String iterator_name;
 	String iterator_index_name;
 	String rml_contents;
+	// The parsed contents, replayed to instance the children of every new iteration.
+	XMLParseRecording rml_recording;
 	ElementAttributes attributes;
 
 	ElementList elements;
+
+	// The expression from the 'data-key' attribute, if any, evaluated for each item using the key iterator slot.
+	DataExpressionPtr key_expression;
+	int key_slot = -1;
+	// The key and iterator slot of each element, when keyed.
+	StringList keys;
+	Vector<int> slots;
+
+	// Set by the 'data-virtual' attribute, with an optional fixed row height. Otherwise, the row height is estimated from the instanced elements.
+	bool virtualized = false;
+	float virtual_row_height = 0;
+	float estimated_row_height = 0;
+	// The index of the first element, when virtualized.
+	int first_index = 0;
+	// Reserve the extent of the items which are not instanced, above and below the elements.
+	ObserverPtr<Element> spacer_before, spacer_after;
+	ObserverPtr<Element> scroll_element;
+	UniquePtr<EventListener> scroll_listener;
 };
 
 } // namespace Rml
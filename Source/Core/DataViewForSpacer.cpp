@@ -0,0 +1,105 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "DataViewForSpacer.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/ElementInstancer.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "DataModel.h"
+
+namespace Rml {
+
+// The number of rows instanced outside the viewport on each side of virtualized 'data-for' views.
+static constexpr int VirtualOverscanRows = 4;
+
+ElementPtr DataViewForSpacer::Create()
+{
+	static ElementInstancerGeneric<DataViewForSpacer> instancer;
+
+	ElementPtr element = instancer.InstanceElement(nullptr, "#spacer", XMLAttributes());
+	element->SetInstancer(&instancer);
+	return element;
+}
+
+DataViewForSpacer::DataViewForSpacer(const String& tag) : Element(tag)
+{}
+
+void DataViewForSpacer::GetVisibleRange(const int in_num_items, const float in_row_height, int& out_first, int& out_last)
+{
+	Element* parent = GetParentNode();
+	if (!parent || in_row_height <= 0.f)
+	{
+		out_first = 0;
+		out_last = 0;
+		return;
+	}
+
+	// Before the first layout the viewport size is not known, then assume the size of the context.
+	float viewport_height = parent->GetClientHeight();
+	if (viewport_height <= 0.f)
+	{
+		Context* context = GetContext();
+		viewport_height = (context ? float(context->GetDimensions().y) : 0.f);
+	}
+
+	const float list_top = GetAbsoluteOffset(Box::BORDER).y - parent->GetAbsoluteOffset(Box::PADDING).y;
+	const float visible_begin = Math::Max(-list_top, 0.f);
+	const float visible_end = viewport_height - list_top;
+
+	out_first = Math::Clamp(int(visible_begin / in_row_height) - VirtualOverscanRows, 0, in_num_items);
+	out_last = Math::Clamp(int(Math::RoundUpFloat(visible_end / in_row_height)) + VirtualOverscanRows, out_first, in_num_items);
+}
+
+void DataViewForSpacer::SetInstancedRange(const String& in_variable_name, const int in_num_items, const float in_row_height, const int in_first,
+	const int in_last)
+{
+	variable_name = in_variable_name;
+	num_items = in_num_items;
+	row_height = in_row_height;
+	first = in_first;
+	last = in_last;
+}
+
+void DataViewForSpacer::CheckVisibleRange()
+{
+	DataModel* model = GetDataModel();
+	if (!model || variable_name.empty() || model->IsVariableDirty(variable_name))
+		return;
+
+	int visible_first = 0, visible_last = 0;
+	GetVisibleRange(num_items, row_height, visible_first, visible_last);
+
+	if (visible_first != first || visible_last != last)
+		model->DirtyVariable(variable_name);
+}
+
+void DataViewForSpacer::OnUpdate()
+{
+	CheckVisibleRange();
+}
+
+} // namespace Rml
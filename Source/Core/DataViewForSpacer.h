@@ -0,0 +1,74 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_DATAVIEWFORSPACER_H
+#define RMLUI_CORE_DATAVIEWFORSPACER_H
+
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Header.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	Reserves the extent of the items which are not instanced by virtualized 'data-for' views.
+
+	The spacer in front of the items also tracks the range of items within the viewport of its parent. The view's container
+	is dirtied when a different range comes into view, which is checked on scroll events and during every update, since the
+	range also changes with the layout.
+ */
+class DataViewForSpacer final : public Element {
+public:
+	RMLUI_RTTI_DefineWithParent(DataViewForSpacer, Element)
+
+	/// Instances a new spacer. Spacers are internal to the view, they are not available through the factory.
+	static ElementPtr Create();
+
+	DataViewForSpacer(const String& tag);
+
+	/// Returns the range of items within the parent's viewport, including a few rows on each side, for items laid out directly after this spacer.
+	void GetVisibleRange(int num_items, float row_height, int& first, int& last);
+
+	/// Sets the range of items instanced by the view, and the variable to dirty when a different range comes into view.
+	void SetInstancedRange(const String& variable_name, int num_items, float row_height, int first, int last);
+
+	/// Dirties the variable if the range of items within the viewport differs from the instanced range.
+	void CheckVisibleRange();
+
+protected:
+	void OnUpdate() override;
+
+private:
+	String variable_name;
+	int num_items = 0;
+	float row_height = 0;
+	int first = 0;
+	int last = 0;
+};
+
+} // namespace Rml
+#endif
@@ -70,7 +70,7 @@ DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) con
 	const Box& box = element->GetBox();
 
 	const ComputedValues& computed = element->GetComputedValues();
-	const float opacity = computed.opacity;
+	const float opacity = computed.inherited->opacity;
 
 	const Vector4f border_radius{
 		computed.border_top_left_radius,
@@ -69,8 +69,8 @@ DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) co
 
 	const Vector2f surface_dimensions = element->GetBox().GetSize(Box::PADDING).Round();
 
-	const float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
+	const float opacity = computed.inherited->opacity;
+	Colourb quad_colour = computed.rare->image_color;
 
 	quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
 
@@ -0,0 +1,188 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "DocumentCache.h"
+#include "DocumentHeader.h"
+#include "StreamFile.h"
+#include "StyleSheetFactory.h"
+#include "Template.h"
+#include "TemplateCache.h"
+#include "XMLParseTools.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StyleSheetContainer.h"
+#include "../../Include/RmlUi/Core/URL.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include <algorithm>
+#include <string.h>
+
+namespace Rml {
+
+static DocumentCache* instance = nullptr;
+
+DocumentCache::DocumentCache()
+{
+	RMLUI_ASSERT(instance == nullptr);
+	instance = this;
+}
+
+DocumentCache::~DocumentCache()
+{
+	instance = nullptr;
+}
+
+bool DocumentCache::Initialise()
+{
+	new DocumentCache();
+
+	return true;
+}
+
+void DocumentCache::Shutdown()
+{
+	delete instance;
+}
+
+void DocumentCache::SetEnabled(bool enabled)
+{
+	instance->enabled = enabled;
+	if (!enabled)
+		Clear();
+}
+
+bool DocumentCache::IsEnabled()
+{
+	return instance->enabled;
+}
+
+SharedPtr<const String> DocumentCache::GetDocument(const String& path)
+{
+	auto itr = instance->documents.find(path);
+	if (itr != instance->documents.end())
+		return itr->second;
+
+	auto stream = MakeUnique<StreamFile>();
+	if (!stream->Open(path))
+		return nullptr;
+
+	StreamMemory compiled_stream(stream->Length() * 2);
+	if (!Factory::CompileDocumentStream(stream.get(), &compiled_stream))
+	{
+		Log::Message(Log::LT_ERROR, "Failed to compile document %s.", path.c_str());
+		return nullptr;
+	}
+
+	auto document = MakeShared<const String>((const char*)compiled_stream.RawStream(), compiled_stream.Length());
+	instance->documents[path] = document;
+
+	return document;
+}
+
+bool DocumentCache::PreloadDocument(const String& path)
+{
+	if (!instance->enabled || !GetDocument(path))
+		return false;
+
+	String source;
+	if (!GetFileInterface()->LoadFile(StringUtilities::Replace(path, '|', ':'), source))
+		return false;
+
+	// Parse the header on its own, like templates do, to load the templates and style sheets it refers to. The line
+	// breaks in front of the header are kept, so that inline style sheets are cached under the line numbers they are
+	// looked up with during loading.
+	const char* head_start = XMLParseTools::FindTag("head", source.c_str());
+	const char* head_end = (head_start ? XMLParseTools::FindTag("head", head_start, true) : nullptr);
+	head_end = (head_end ? strchr(head_end, '>') : nullptr);
+	if (!head_end)
+		return true;
+
+	String header_source(std::count(source.c_str(), head_start, '\n'), '\n');
+	header_source.append(head_start, head_end + 1);
+
+	StreamMemory header_stream((const byte*)header_source.data(), header_source.size());
+	header_stream.SetSourceURL(StringUtilities::Replace(path, ':', '|'));
+
+	XMLParser parser(nullptr);
+	parser.Parse(&header_stream);
+	const DocumentHeader* document_header = parser.GetDocumentHeader();
+
+	// Merge the templates as ElementDocument::ProcessHeader() does.
+	DocumentHeader header;
+	header.MergePaths(header.template_resources, document_header->template_resources, document_header->source);
+
+	for (size_t i = 0; i < header.template_resources.size(); i++)
+	{
+		if (Template* merge_template = TemplateCache::LoadTemplate(URL(header.template_resources[i]).GetURL()))
+			header.MergeHeader(*merge_template->GetHeader());
+	}
+
+	header.MergeHeader(*document_header);
+
+	for (const DocumentHeader::Resource& rcss : header.rcss)
+	{
+		if (rcss.is_inline)
+			GetInlineStyleSheet(rcss.content, rcss.path, rcss.line);
+		else
+			StyleSheetFactory::GetStyleSheetContainer(rcss.path);
+	}
+
+	return true;
+}
+
+const StyleSheetContainer* DocumentCache::GetInlineStyleSheet(const String& content, const String& source_path, int line)
+{
+	// The source location is part of the key, as it is stored with the parsed properties.
+	const String key = source_path + '\n' + ToString(line) + '\n' + content;
+
+	auto itr = instance->inline_style_sheets.find(key);
+	if (itr != instance->inline_style_sheets.end())
+		return itr->second.get();
+
+	auto style_sheet = MakeShared<StyleSheetContainer>();
+	StreamMemory stream((const byte*)content.c_str(), content.size());
+	stream.SetSourceURL(source_path);
+
+	// Style sheets which fail to load are cached as well, so that their errors are only reported once.
+	if (!style_sheet->LoadStyleSheetContainer(&stream, line))
+		style_sheet.reset();
+
+	instance->inline_style_sheets[key] = style_sheet;
+
+	return style_sheet.get();
+}
+
+void DocumentCache::Clear()
+{
+	instance->documents.clear();
+	instance->inline_style_sheets.clear();
+}
+
+} // namespace Rml
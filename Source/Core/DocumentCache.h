@@ -0,0 +1,83 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_DOCUMENTCACHE_H
+#define RMLUI_CORE_DOCUMENTCACHE_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class StyleSheetContainer;
+
+/**
+	Caches the parsed form of documents loaded from files, when enabled.
+
+	Documents are stored as compiled RML, which is replayed into the node handlers on every load without reading the
+	file or running the XML parser again. Inline style sheets are parsed once and merged into each document's style
+	sheet like style sheets from files. The instanced elements themselves are not shared, since their data views,
+	event listeners and scripts are bound to the document they were instanced into.
+ */
+
+class DocumentCache
+{
+public:
+	/// Initialisation and Shutdown
+	static bool Initialise();
+	static void Shutdown();
+
+	/// Enables or disables the cache, clearing it when disabled.
+	static void SetEnabled(bool enabled);
+	static bool IsEnabled();
+
+	/// Returns the compiled RML of the document at the given path, loading and compiling it if it is not already cached.
+	/// @return The compiled RML, or nullptr if the document could not be loaded.
+	static SharedPtr<const String> GetDocument(const String& path);
+
+	/// Loads the document at the given path into the cache, along with the templates and style sheets of its header.
+	static bool PreloadDocument(const String& path);
+
+	/// Returns the parsed inline style sheet with the given contents, parsing it if it is not already cached.
+	/// @return The style sheet, or nullptr if it could not be parsed.
+	static const StyleSheetContainer* GetInlineStyleSheet(const String& content, const String& source_path, int line);
+
+	/// Clear the document cache.
+	static void Clear();
+
+private:
+	DocumentCache();
+	~DocumentCache();
+
+	bool enabled = false;
+
+	UnorderedMap<String, SharedPtr<const String>> documents;
+	UnorderedMap<String, SharedPtr<StyleSheetContainer>> inline_style_sheets;
+};
+
+} // namespace Rml
+#endif
@@ -0,0 +1,256 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "DrawListRecorder.h"
+#include "TextureDatabase.h"
+
+namespace Rml {
+
+// Generations are unique across all recorders, so that segments can never be replayed from the wrong recorder.
+static uint64_t generation_counter = 0;
+
+DrawListRecorder::DrawListRecorder(bool retained) : retained(retained)
+{}
+
+void DrawListRecorder::Begin()
+{
+	RMLUI_ASSERT(!recording);
+
+	previous_generation = generation;
+	generation = ++generation_counter;
+
+	// Released textures may leave expired handles in the previous frame, then none of its segments can be replayed.
+	const uint64_t new_texture_release_counter = TextureDatabase::GetReleaseTexturesCounter();
+	if (new_texture_release_counter != texture_release_counter)
+	{
+		texture_release_counter = new_texture_release_counter;
+		previous_generation = 0;
+	}
+
+	if (retained)
+		current_frame = (current_frame + 1) % 2;
+
+	Frame& frame = frames[current_frame];
+	frame.draw_list.Clear();
+	frame.chunks.clear();
+
+	transform_index = -1;
+	scissor_enabled = false;
+	scissor_origin = Vector2i(0, 0);
+	scissor_dimensions = Vector2i(0, 0);
+
+	recording = true;
+}
+
+const DrawList& DrawListRecorder::End()
+{
+	recording = false;
+	return frames[current_frame].draw_list;
+}
+
+const DrawList& DrawListRecorder::GetLastDrawList() const
+{
+	return frames[current_frame].draw_list;
+}
+
+bool DrawListRecorder::CanReuseLastDrawList() const
+{
+	return retained && !recording && generation > 0 && texture_release_counter == TextureDatabase::GetReleaseTexturesCounter();
+}
+
+void DrawListRecorder::AddGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, TextureHandle texture,
+	Vector2f translation)
+{
+	RMLUI_ASSERT(recording);
+	if (num_vertices <= 0 || num_indices <= 0)
+		return;
+
+	DrawList& draw_list = frames[current_frame].draw_list;
+	const int index_base = AppendChunk(texture, num_vertices, num_indices);
+
+	const size_t vertex_begin = draw_list.vertices.size();
+	draw_list.vertices.insert(draw_list.vertices.end(), vertices, vertices + num_vertices);
+	for (size_t i = vertex_begin; i < draw_list.vertices.size(); i++)
+		draw_list.vertices[i].position += translation;
+
+	draw_list.indices.reserve(draw_list.indices.size() + (size_t)num_indices);
+	for (int i = 0; i < num_indices; i++)
+		draw_list.indices.push_back(indices[i] + index_base);
+}
+
+void DrawListRecorder::SetTransform(const Matrix4f* transform)
+{
+	if (!transform)
+	{
+		transform_index = -1;
+		return;
+	}
+
+	DrawList& draw_list = frames[current_frame].draw_list;
+	if (!draw_list.transforms.empty() && draw_list.transforms.back() == *transform)
+	{
+		transform_index = (int)draw_list.transforms.size() - 1;
+		return;
+	}
+
+	transform_index = (int)draw_list.transforms.size();
+	draw_list.transforms.push_back(*transform);
+}
+
+void DrawListRecorder::SetScissorRegion(bool enable, Vector2i origin, Vector2i dimensions)
+{
+	scissor_enabled = enable;
+	scissor_origin = (enable ? origin : Vector2i(0, 0));
+	scissor_dimensions = (enable ? dimensions : Vector2i(0, 0));
+}
+
+void DrawListRecorder::BeginSegment(Segment& segment)
+{
+	RMLUI_ASSERT(recording && retained);
+	segment.generation = 0;
+	segment.chunk_begin = (int)frames[current_frame].chunks.size();
+	segment.chunk_end = segment.chunk_begin;
+}
+
+void DrawListRecorder::EndSegment(Segment& segment)
+{
+	RMLUI_ASSERT(recording && retained);
+	segment.generation = generation;
+	segment.chunk_end = (int)frames[current_frame].chunks.size();
+}
+
+bool DrawListRecorder::ReplaySegment(Segment& segment)
+{
+	RMLUI_ASSERT(recording && retained);
+	if (segment.generation == 0 || segment.generation != previous_generation)
+		return false;
+
+	const Frame& previous = frames[(current_frame + 1) % 2];
+	DrawList& draw_list = frames[current_frame].draw_list;
+
+	// Replaying a segment must not affect the render state of the following geometry.
+	const int previous_transform_index = transform_index;
+	const bool previous_scissor_enabled = scissor_enabled;
+	const Vector2i previous_scissor_origin = scissor_origin;
+	const Vector2i previous_scissor_dimensions = scissor_dimensions;
+
+	const int chunk_begin = (int)frames[current_frame].chunks.size();
+
+	for (int i = segment.chunk_begin; i < segment.chunk_end; i++)
+	{
+		const Chunk& chunk = previous.chunks[i];
+
+		SetTransform(chunk.transform_index >= 0 ? &previous.draw_list.transforms[chunk.transform_index] : nullptr);
+		SetScissorRegion(chunk.scissor_enabled, chunk.scissor_origin, chunk.scissor_dimensions);
+
+		const int index_base = AppendChunk(chunk.texture, chunk.num_vertices, chunk.num_indices);
+
+		// Translations are already baked into the recorded vertices.
+		const Vertex* vertices = previous.draw_list.vertices.data() + chunk.vertex_offset;
+		draw_list.vertices.insert(draw_list.vertices.end(), vertices, vertices + chunk.num_vertices);
+
+		const int index_shift = index_base - chunk.index_base;
+		const int* indices = previous.draw_list.indices.data() + chunk.index_offset;
+		draw_list.indices.reserve(draw_list.indices.size() + (size_t)chunk.num_indices);
+		for (int j = 0; j < chunk.num_indices; j++)
+			draw_list.indices.push_back(indices[j] + index_shift);
+	}
+
+	transform_index = previous_transform_index;
+	scissor_enabled = previous_scissor_enabled;
+	scissor_origin = previous_scissor_origin;
+	scissor_dimensions = previous_scissor_dimensions;
+
+	segment.generation = generation;
+	segment.chunk_begin = chunk_begin;
+	segment.chunk_end = (int)frames[current_frame].chunks.size();
+
+	return true;
+}
+
+bool DrawListRecorder::IsCompatible(const DrawCommand& command, TextureHandle texture) const
+{
+	if (command.texture != texture || command.scissor_enabled != scissor_enabled)
+		return false;
+
+	if (scissor_enabled && (command.scissor_origin != scissor_origin || command.scissor_dimensions != scissor_dimensions))
+		return false;
+
+	if (command.transform_index == transform_index)
+		return true;
+
+	// Different transform entries may still hold equal matrices, e.g. when returning to a previous transform.
+	const DrawList& draw_list = frames[current_frame].draw_list;
+	return command.transform_index >= 0 && transform_index >= 0 &&
+		draw_list.transforms[command.transform_index] == draw_list.transforms[transform_index];
+}
+
+int DrawListRecorder::AppendChunk(TextureHandle texture, int num_vertices, int num_indices)
+{
+	Frame& frame = frames[current_frame];
+	DrawList& draw_list = frame.draw_list;
+
+	if (draw_list.commands.empty() || !IsCompatible(draw_list.commands.back(), texture))
+	{
+		DrawCommand command;
+		command.texture = texture;
+		command.vertex_offset = (int)draw_list.vertices.size();
+		command.index_offset = (int)draw_list.indices.size();
+		command.transform_index = transform_index;
+		command.scissor_enabled = scissor_enabled;
+		command.scissor_origin = scissor_origin;
+		command.scissor_dimensions = scissor_dimensions;
+		draw_list.commands.push_back(command);
+	}
+
+	DrawCommand& command = draw_list.commands.back();
+
+	// Indices are relative to the first vertex of the command, offset them by the vertices already in the command.
+	const int index_base = command.num_vertices;
+	command.num_vertices += num_vertices;
+	command.num_indices += num_indices;
+
+	if (retained)
+	{
+		Chunk chunk;
+		chunk.texture = texture;
+		chunk.transform_index = transform_index;
+		chunk.scissor_enabled = scissor_enabled;
+		chunk.scissor_origin = scissor_origin;
+		chunk.scissor_dimensions = scissor_dimensions;
+		chunk.vertex_offset = (int)draw_list.vertices.size();
+		chunk.num_vertices = num_vertices;
+		chunk.index_offset = (int)draw_list.indices.size();
+		chunk.num_indices = num_indices;
+		chunk.index_base = index_base;
+		frame.chunks.push_back(chunk);
+	}
+
+	return index_base;
+}
+
+} // namespace Rml
@@ -0,0 +1,133 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_DRAWLISTRECORDER_H
+#define RMLUI_CORE_DRAWLISTRECORDER_H
+
+#include "../../Include/RmlUi/Core/DrawList.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <stdint.h>
+
+namespace Rml {
+
+/**
+	Records the render calls made during a context's render traversal into a draw list.
+
+	Geometry submitted in sequence with equal texture, transform and scissor state is merged into the same command, with
+	its translation baked into the vertex positions.
+
+	In retained mode, the recorder keeps the draw list of the previous frame around. Elements store the range of geometry
+	they recorded as a segment, which can be replayed into the next frame's draw list as long as the element is unchanged.
+ */
+
+class DrawListRecorder
+{
+public:
+	// A range of geometry recorded by an element, only valid for replay into the draw list following the one it was recorded in.
+	struct Segment {
+		uint64_t generation = 0;
+		int chunk_begin = 0;
+		int chunk_end = 0;
+	};
+
+	DrawListRecorder(bool retained);
+
+	// Clears the draw list and starts recording with an untransformed, unclipped render state.
+	void Begin();
+	// Stops recording, and returns the recorded draw list which stays valid until the next call to Begin().
+	const DrawList& End();
+
+	bool IsRecording() const { return recording; }
+	bool IsRetained() const { return retained; }
+
+	// Returns the draw list from the last recording, it is valid for submission again if nothing has changed since.
+	const DrawList& GetLastDrawList() const;
+	// Returns true if the last recorded draw list is still valid, and can be submitted again without recording.
+	bool CanReuseLastDrawList() const;
+
+	void AddGeometry(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, TextureHandle texture, Vector2f translation);
+
+	void SetTransform(const Matrix4f* transform);
+	void SetScissorRegion(bool enable, Vector2i origin, Vector2i dimensions);
+
+	// Marks the start of the geometry recorded by an element.
+	void BeginSegment(Segment& segment);
+	// Marks the end of the geometry recorded by an element, making the segment available for replay in the next frame.
+	void EndSegment(Segment& segment);
+	// Copies the geometry of a segment recorded during the previous frame into the current draw list, and updates the
+	// segment to point to the copy. Returns false if the segment has expired, then it needs to be recorded again.
+	bool ReplaySegment(Segment& segment);
+
+private:
+	// The render state and data range of each geometry added to the draw list, used for replaying segments.
+	struct Chunk {
+		TextureHandle texture;
+		int transform_index;
+		bool scissor_enabled;
+		Vector2i scissor_origin;
+		Vector2i scissor_dimensions;
+
+		int vertex_offset;
+		int num_vertices;
+		int index_offset;
+		int num_indices;
+		// The offset added to the chunk's indices, due to preceding vertices in the same command.
+		int index_base;
+	};
+
+	struct Frame {
+		DrawList draw_list;
+		Vector<Chunk> chunks;
+	};
+
+	// Returns true if the given command can be extended by geometry using the current render state.
+	bool IsCompatible(const DrawCommand& command, TextureHandle texture) const;
+
+	// Appends a new chunk using the current render state, and returns the index base of its indices.
+	int AppendChunk(TextureHandle texture, int num_vertices, int num_indices);
+
+	bool recording = false;
+	const bool retained;
+
+	// A new generation is started on every recording, used to validate segments. Zero is reserved for never-recorded segments.
+	uint64_t generation = 0;
+	uint64_t previous_generation = 0;
+	// Set when the textures have been released since the last recording, which invalidates all recorded geometry.
+	uint64_t texture_release_counter = 0;
+
+	int transform_index = -1;
+	bool scissor_enabled = false;
+	Vector2i scissor_origin;
+	Vector2i scissor_dimensions;
+
+	// The frames are swapped on every recording, the previous frame is used as the source of replayed segments.
+	Frame frames[2];
+	int current_frame = 0;
+};
+
+} // namespace Rml
+#endif
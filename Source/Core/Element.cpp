@@ -43,9 +43,11 @@
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "AncestorFilter.h"
 #include "Clock.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
+#include "DrawListRecorder.h"
 #include "ElementAnimation.h"
 #include "ElementBackgroundBorder.h"
 #include "ElementDefinition.h"
@@ -53,7 +55,10 @@
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
 #include "ElementDecoration.h"
+#include "HitTestGrid.h"
+#include "LayoutCache.h"
 #include "LayoutEngine.h"
+#include "Memory.h"
 #include "PluginRegistry.h"
 #include "PropertiesIterator.h"
 #include "Pool.h"
@@ -61,6 +66,7 @@
 #include "StyleSheetNode.h"
 #include "TransformState.h"
 #include "TransformUtilities.h"
+#include "WorkerPool.h"
 #include "XMLParseTools.h"
 #include <algorithm>
 #include <cmath>
@@ -81,15 +87,83 @@ struct ElementMeta
 	ElementDecoration decoration;
 	ElementScroll scroll;
 	Style::ComputedValues computed_values;
+	DrawListRecorder::Segment render_segment;
+	LayoutCache layout_cache;
+	// The grid used to look up elements in this element's local stacking context.
+	UniquePtr<HitTestGrid> hit_test_grid;
+	// Incremented when any element's boxes or offsets change, only used by documents.
+	unsigned int hit_test_generation = 0;
 };
 
 
 static Pool< ElementMeta > element_meta_chunk_pool(200, true);
 
+// Index of the child currently being updated by its parent, used to locate recently updated siblings for style sharing.
+static thread_local size_t updating_child_index = 0;
+// The number of preceding siblings considered when looking for computed values to share.
+static constexpr size_t MaxStyleSharingCandidates = 4;
+
+template <typename Dispatch>
+static bool DispatchEventOnCallingThread(Dispatch&& dispatch)
+{
+	bool result = false;
+	WorkerPool::RunOnCallingThread([&]() { result = dispatch(); });
+	return result;
+}
+
+// Returns true if the element's box is used to clip its descendants.
+static inline bool ClipsDescendants(const ComputedValues& computed)
+{
+	return computed.overflow_x != Style::Overflow::Visible || computed.overflow_y != Style::Overflow::Visible;
+}
+
+// Returns true if the animated value of the property only affects rendering, and can be written directly into the computed values.
+static bool IsAnimatedValueDirect(const PropertyId id, const Property& property)
+{
+	switch (id)
+	{
+	case PropertyId::Transform:
+		return property.unit == Property::TRANSFORM;
+	case PropertyId::Opacity:
+		return property.unit == Property::NUMBER;
+	case PropertyId::Color:
+	case PropertyId::BackgroundColor:
+	case PropertyId::BorderTopColor:
+	case PropertyId::BorderRightColor:
+	case PropertyId::BorderBottomColor:
+	case PropertyId::BorderLeftColor:
+	case PropertyId::ImageColor:
+		return property.unit == Property::COLOUR;
+	default:
+		break;
+	}
+	return false;
+}
+
+// Writes an animated value directly into the computed values, must match the computation in ElementStyle::ComputeValues().
+static void WriteAnimatedValue(ComputedValues& values, const PropertyId id, const Property& property)
+{
+	switch (id)
+	{
+	case PropertyId::Transform:         values.rare.Write().transform = property.Get<TransformPtr>(); break;
+	case PropertyId::Opacity:           values.inherited.Write().opacity = property.Get<float>(); break;
+	case PropertyId::Color:             values.inherited.Write().color = property.Get<Colourb>(); break;
+	case PropertyId::BackgroundColor:   values.background_color = property.Get<Colourb>(); break;
+	case PropertyId::BorderTopColor:    values.border_top_color = property.Get<Colourb>(); break;
+	case PropertyId::BorderRightColor:  values.border_right_color = property.Get<Colourb>(); break;
+	case PropertyId::BorderBottomColor: values.border_bottom_color = property.Get<Colourb>(); break;
+	case PropertyId::BorderLeftColor:   values.border_left_color = property.Get<Colourb>(); break;
+	case PropertyId::ImageColor:        values.rare.Write().image_color = property.Get<Colourb>(); break;
+	default:
+		RMLUI_ERROR;
+		break;
+	}
+}
+
 
 /// Constructs a new RmlUi element.
 Element::Element(const String& tag) : tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0), content_offset(0, 0), content_box(0, 0), 
-transform_state(), dirty_transform(false), dirty_perspective(false), dirty_animation(false), dirty_transition(false)
+transform_state(), dirty_transform(false), dirty_perspective(false), dirty_animation(false), dirty_transition(false), render_dirty(true)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
 	parent = nullptr;
@@ -153,6 +227,21 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 	RMLUI_ZoneText(name.c_str(), name.size());
 #endif
 
+	UpdateSelf(dp_ratio, vp_dimensions);
+
+	AncestorFilter::PushElement(this);
+
+	for (size_t i = 0; i < children.size(); i++)
+	{
+		updating_child_index = i;
+		children[i]->Update(dp_ratio, vp_dimensions);
+	}
+
+	AncestorFilter::PopElement(this);
+}
+
+void Element::UpdateSelf(float dp_ratio, Vector2f vp_dimensions)
+{
 	OnUpdate();
 
 	UpdateStructure();
@@ -174,9 +263,6 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 	}
 
 	meta->decoration.InstanceDecorators();
-
-	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio, vp_dimensions);
 }
 
 void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimensions)
@@ -188,8 +274,12 @@ void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimension
 		const ComputedValues* parent_values = parent ? &parent->GetComputedValues() : nullptr;
 		const ComputedValues* document_values = owner_document ? &owner_document->GetComputedValues() : nullptr;
 
-		// Compute values and clear dirty properties
-		PropertyIdSet dirty_properties = meta->style.ComputeValues(meta->computed_values, parent_values, document_values, computed_values_are_default_initialized, dp_ratio, vp_dimensions);
+		// Compute values and clear dirty properties, or copy them from a sibling with identical style when possible.
+		PropertyIdSet dirty_properties;
+		if (const Element* sibling = FindStyleSharingSibling())
+			dirty_properties = meta->style.ShareComputedValues(meta->computed_values, sibling->meta->computed_values);
+		else
+			dirty_properties = meta->style.ComputeValues(meta->computed_values, parent_values, document_values, computed_values_are_default_initialized, dp_ratio, vp_dimensions);
 
 		computed_values_are_default_initialized = false;
 
@@ -200,6 +290,57 @@ void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimension
 	}
 }
 
+const Element* Element::FindStyleSharingSibling() const
+{
+	// The index is only valid while our parent is iterating its children, verify that we are the element being updated.
+	const size_t index = updating_child_index;
+	if (!parent || owner_document == this || index >= parent->children.size() || parent->children[index].get() != this)
+		return nullptr;
+
+	const size_t first_candidate = (index > MaxStyleSharingCandidates ? index - MaxStyleSharingCandidates : 0);
+	for (size_t i = index; i-- > first_candidate;)
+	{
+		const Element* sibling = parent->children[i].get();
+		if (!sibling->computed_values_are_default_initialized && sibling->owner_document == owner_document &&
+			meta->style.CanShareComputedValues(sibling->meta->style))
+			return sibling;
+	}
+
+	return nullptr;
+}
+
+void Element::ReorderChildren(const ElementList& ordered_children)
+{
+	UnorderedMap<Element*, ElementPtr> detached_children;
+	detached_children.reserve(ordered_children.size());
+	for (Element* child : ordered_children)
+		detached_children.emplace(child, nullptr);
+
+	Vector<size_t> positions;
+	positions.reserve(ordered_children.size());
+	for (size_t i = 0; i < children.size(); i++)
+	{
+		if (detached_children.count(children[i].get()) == 1)
+			positions.push_back(i);
+	}
+
+	if (positions.size() != ordered_children.size() || detached_children.size() != ordered_children.size())
+	{
+		RMLUI_ERRORMSG("All reordered elements must be unique children of this element.");
+		return;
+	}
+
+	for (size_t position : positions)
+		detached_children[children[position].get()] = std::move(children[position]);
+
+	for (size_t i = 0; i < positions.size(); i++)
+		children[positions[i]] = std::move(detached_children[ordered_children[i]]);
+
+	DirtyLayout();
+	DirtyStackingContext();
+	DirtyStructure();
+}
+
 void Element::Render()
 {
 #ifdef RMLUI_ENABLE_PROFILING
@@ -219,6 +360,24 @@ void Element::Render()
 
 	UpdateTransformState();
 
+	// With retained rendering, replay the geometry recorded during the previous frame if nothing has changed since.
+	DrawListRecorder* recorder = nullptr;
+	if (Context* context = GetContext())
+	{
+		recorder = context->GetActiveDrawListRecorder();
+		if (recorder && !recorder->IsRetained())
+			recorder = nullptr;
+	}
+
+	if (recorder)
+	{
+		if (!render_dirty && recorder->ReplaySegment(meta->render_segment))
+			return;
+
+		render_dirty = false;
+		recorder->BeginSegment(meta->render_segment);
+	}
+
 	// Render all elements in our local stacking context that have a z-index beneath our local index of 0.
 	size_t i = 0;
 	for (; i < stacking_context.size() && stacking_context[i]->z_index < 0; ++i)
@@ -243,6 +402,9 @@ void Element::Render()
 	// Render the rest of the elements in the stacking context.
 	for (; i < stacking_context.size(); ++i)
 		stacking_context[i]->Render();
+
+	if (recorder)
+		recorder->EndSegment(meta->render_segment);
 }
 
 // Clones this element, returning a new, unparented element.
@@ -452,6 +614,7 @@ void Element::SetContentBox(Vector2f _content_offset, Vector2f _content_box)
 		scroll_offset.x = Math::Min(scroll_offset.x, GetScrollWidth() - GetClientWidth());
 		scroll_offset.y = Math::Min(scroll_offset.y, GetScrollHeight() - GetClientHeight());
 		DirtyAbsoluteOffset();
+		DirtyRender();
 	}
 }
 
@@ -464,10 +627,16 @@ void Element::SetBox(const Box& box)
 		additional_boxes.clear();
 
 		OnResize();
+		DirtyHitTest();
 
 		meta->background_border.DirtyBackground();
 		meta->background_border.DirtyBorder();
 		meta->decoration.DirtyDecoratorsData();
+
+		if (ClipsDescendants(meta->computed_values))
+			DirtyRenderRecursive();
+		else
+			DirtyRender();
 	}
 }
 
@@ -477,10 +646,16 @@ void Element::AddBox(const Box& box, Vector2f offset)
 	additional_boxes.emplace_back(PositionedBox{ box, offset });
 
 	OnResize();
+	DirtyHitTest();
 
 	meta->background_border.DirtyBackground();
 	meta->background_border.DirtyBorder();
 	meta->decoration.DirtyDecoratorsData();
+
+	if (ClipsDescendants(meta->computed_values))
+		DirtyRenderRecursive();
+	else
+		DirtyRender();
 }
 
 // Returns one of the boxes describing the size of the element.
@@ -565,7 +740,7 @@ float Element::GetZIndex() const
 // Returns the element's font face handle.
 FontFaceHandle Element::GetFontFaceHandle() const
 {
-	return meta->computed_values.font_face_handle;
+	return meta->computed_values.inherited->font_face_handle;
 }
 
 // Sets a local property override on the element.
@@ -695,7 +870,7 @@ Style::Display Element::GetDisplay()
 
 float Element::GetLineHeight()
 {
-	return meta->computed_values.line_height.value;
+	return meta->computed_values.inherited->line_height.value;
 }
 
 // Returns this element's TransformState
@@ -1155,7 +1330,7 @@ void Element::SetInnerRML(const String& rml)
 bool Element::Focus()
 {
 	// Are we allowed focus?
-	Style::Focus focus_property = meta->computed_values.focus;
+	Style::Focus focus_property = meta->computed_values.inherited->focus;
 	if (focus_property == Style::Focus::None)
 		return false;
 
@@ -1241,6 +1416,10 @@ void Element::RemoveEventListener(EventId id, EventListener* listener, bool in_c
 // Dispatches the specified event
 bool Element::DispatchEvent(const String& type, const Dictionary& parameters)
 {
+	// Event listeners are always called on the thread updating the context.
+	if (WorkerPool::IsInParallelLoop())
+		return DispatchEventOnCallingThread([&]() { return DispatchEvent(type, parameters); });
+
 	const EventSpecification& specification = EventSpecificationInterface::GetOrInsert(type);
 	return EventDispatcher::DispatchEvent(this, specification.id, type, parameters, specification.interruptible, specification.bubbles, specification.default_action_phase);
 }
@@ -1248,6 +1427,9 @@ bool Element::DispatchEvent(const String& type, const Dictionary& parameters)
 // Dispatches the specified event
 bool Element::DispatchEvent(const String& type, const Dictionary& parameters, bool interruptible, bool bubbles)
 {
+	if (WorkerPool::IsInParallelLoop())
+		return DispatchEventOnCallingThread([&]() { return DispatchEvent(type, parameters, interruptible, bubbles); });
+
 	const EventSpecification& specification = EventSpecificationInterface::GetOrInsert(type);
 	return EventDispatcher::DispatchEvent(this, specification.id, type, parameters, interruptible, bubbles, specification.default_action_phase);
 }
@@ -1255,6 +1437,9 @@ bool Element::DispatchEvent(const String& type, const Dictionary& parameters, bo
 // Dispatches the specified event
 bool Element::DispatchEvent(EventId id, const Dictionary& parameters)
 {
+	if (WorkerPool::IsInParallelLoop())
+		return DispatchEventOnCallingThread([&]() { return DispatchEvent(id, parameters); });
+
 	const EventSpecification& specification = EventSpecificationInterface::Get(id);
 	return EventDispatcher::DispatchEvent(this, specification.id, specification.type, parameters, specification.interruptible, specification.bubbles, specification.default_action_phase);
 }
@@ -1660,6 +1845,9 @@ void Element::OnStyleSheetChange()
 // Called when attributes on the element are changed.
 void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
+	// Attributes such as an image source or a disabled state may change how the element is rendered.
+	DirtyRender();
+
 	for (const auto& element_attribute : changed_attributes)
 	{
 		const auto& attribute = element_attribute.first;
@@ -1729,13 +1917,28 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
 
-	if (!IsLayoutDirty())
+	DirtyRender();
+
+	// Changes to clipping affect the render state of all our descendants.
+	if (changed_properties.Contains(PropertyId::OverflowX) ||
+		changed_properties.Contains(PropertyId::OverflowY) ||
+		changed_properties.Contains(PropertyId::Clip))
+	{
+		DirtyRenderRecursive();
+	}
+
 	{
-		// Force a relayout if any of the changed properties require it.
+		// Force a relayout if any of the changed properties require it. Our own box may change, thus the layout can only be
+		// contained by a boundary above us.
 		const PropertyIdSet changed_properties_forcing_layout = (changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
 		
-		if(!changed_properties_forcing_layout.Empty())
-			DirtyLayout();
+		if (!changed_properties_forcing_layout.Empty())
+		{
+			if (parent)
+				DirtyLayoutFromBoundary(parent);
+			else
+				DirtyLayout();
+		}
 	}
 
 	const bool border_radius_changed = (
@@ -1911,9 +2114,36 @@ void Element::OnChildRemove(Element* /*child*/)
 // Forces a re-layout of this element, and any other children required.
 void Element::DirtyLayout()
 {
-	Element* document = GetOwnerDocument();
-	if (document != nullptr)
-		document->DirtyLayout();
+	DirtyLayoutFromBoundary(this);
+}
+
+void Element::DirtyLayoutFromBoundary(Element* element)
+{
+	// Any measurements of ourself or our ancestors may depend on our layout.
+	for (Element* ancestor = this; ancestor; ancestor = ancestor->parent)
+		ancestor->meta->layout_cache.Clear();
+
+	// Nothing more to do if the whole document is already going to be formatted. The layout caches above must still be
+	// cleared though, as they are kept across layout updates.
+	ElementDocument* document = GetOwnerDocument();
+	if (document == nullptr || document->layout_dirty)
+		return;
+
+	for (Element* ancestor = element; ancestor && ancestor != document; ancestor = ancestor->GetParentNode())
+	{
+		if (LayoutEngine::IsLayoutBoundary(ancestor))
+		{
+			document->DirtyLayoutBoundary(ancestor);
+			return;
+		}
+	}
+
+	document->DirtyLayout();
+}
+
+LayoutCache& Element::GetLayoutCache()
+{
+	return meta->layout_cache;
 }
 
 // Forces a re-layout of this element, and any other children required.
@@ -1954,7 +2184,7 @@ void Element::ProcessDefaultAction(Event& event)
 					(wheel_delta > 0 && GetScrollHeight() > GetScrollTop() + GetClientHeight()))
 				{
 					// Defined as three times the default line-height, multiplied by the dp ratio.
-					float default_scroll_length = 3.f * DefaultComputedValues.line_height.value;
+					float default_scroll_length = 3.f * DefaultComputedValues.inherited->line_height.value;
 					if (const Context* context = GetContext())
 						default_scroll_length *= context->GetDensityIndependentPixelRatio();
 
@@ -2064,6 +2294,13 @@ void Element::SetDataModel(DataModel* new_data_model)
 
 void Element::Release()
 {
+	// The instancers and element pools are not thread-safe, release the element on the thread updating the context.
+	if (WorkerPool::IsInParallelLoop())
+	{
+		WorkerPool::RunOnCallingThread([this]() { Release(); });
+		return;
+	}
+
 	if (instancer)
 		instancer->ReleaseElement(this);
 	else
@@ -2124,7 +2361,10 @@ void Element::SetParent(Element* _parent)
 void Element::DirtyAbsoluteOffset()
 {
 	if (!absolute_offset_dirty)
+	{
+		DirtyRender();
 		DirtyAbsoluteOffsetRecursive();
+	}
 }
 
 void Element::DirtyAbsoluteOffsetRecursive()
@@ -2132,11 +2372,14 @@ void Element::DirtyAbsoluteOffsetRecursive()
 	if (!absolute_offset_dirty)
 	{
 		absolute_offset_dirty = true;
+		DirtyHitTest();
 
 		if (transform_state)
 			DirtyTransformState(true, true);
 	}
 
+	render_dirty = true;
+
 	for (size_t i = 0; i < children.size(); i++)
 		children[i]->DirtyAbsoluteOffsetRecursive();
 }
@@ -2214,6 +2457,7 @@ void Element::BuildLocalStackingContext()
 {
 	stacking_context_dirty = false;
 	stacking_context.clear();
+	DirtyHitTest();
 
 	BuildStackingContext(&stacking_context);
 	std::stable_sort(stacking_context.begin(), stacking_context.end(), [](const Element* lhs, const Element* rhs) { return lhs->GetZIndex() < rhs->GetZIndex(); });
@@ -2225,6 +2469,58 @@ struct StackingOrderedChild {
 	RenderOrder order;
 	bool include_children;
 };
+using StackingOrderedChildList = FrameVector<StackingOrderedChild>;
+
+static void BuildStackingContextForTable(StackingOrderedChildList& ordered_children, Element* parent)
+{
+	const int num_children = parent->GetNumChildren(true);
+
+	for (int i = 0; i < num_children; ++i)
+	{
+		Element* child = parent->GetChild(i);
+
+		if (!child->IsVisible())
+			continue;
+
+		ordered_children.emplace_back();
+		StackingOrderedChild& ordered_child = ordered_children.back();
+		ordered_child.element = child;
+		ordered_child.order = RenderOrder::Inline;
+		ordered_child.include_children = false;
+
+		bool recurse_into_children = false;
+
+		switch (child->GetDisplay())
+		{
+		case Style::Display::TableRow:
+			ordered_child.order = RenderOrder::TableRow;
+			recurse_into_children = true;
+			break;
+		case Style::Display::TableRowGroup:
+			ordered_child.order = RenderOrder::TableRowGroup;
+			recurse_into_children = true;
+			break;
+		case Style::Display::TableColumn:
+			ordered_child.order = RenderOrder::TableColumn;
+			break;
+		case Style::Display::TableColumnGroup:
+			ordered_child.order = RenderOrder::TableColumnGroup;
+			recurse_into_children = true;
+			break;
+		case Style::Display::TableCell:
+			ordered_child.order = RenderOrder::TableCell;
+			ordered_child.include_children = true;
+			break;
+		default:
+			ordered_child.order = RenderOrder::Positioned;
+			ordered_child.include_children = true;
+			break;
+		}
+
+		if (recurse_into_children)
+			BuildStackingContextForTable(ordered_children, child);
+	}
+}
 
 void Element::BuildStackingContext(ElementList* new_stacking_context)
 {
@@ -2232,8 +2528,9 @@ void Element::BuildStackingContext(ElementList* new_stacking_context)
 
 	// Build the list of ordered children. Our child list is sorted within the stacking context so stacked elements
 	// will render in the right order; ie, positioned elements will render on top of inline elements, which will render
-	// on top of floated elements, which will render on top of block elements.
-	Vector< StackingOrderedChild > ordered_children;
+	// on top of floated elements, which will render on top of block elements. The list is only needed while building
+	// the stacking context, thus it is allocated from the frame arena when available.
+	StackingOrderedChildList ordered_children;
 
 	const size_t num_children = children.size();
 	ordered_children.reserve(num_children);
@@ -2256,7 +2553,7 @@ void Element::BuildStackingContext(ElementList* new_stacking_context)
 
 			ordered_child.element = child;
 			ordered_child.order = RenderOrder::Inline;
-			ordered_child.include_children = !child->local_stacking_context;
+			ordered_child.include_children = true;
 
 			const Style::Display child_display = child->GetDisplay();
 
@@ -2274,64 +2571,15 @@ void Element::BuildStackingContext(ElementList* new_stacking_context)
 	// Sort the list!
 	std::stable_sort(ordered_children.begin(), ordered_children.end(), [](const StackingOrderedChild& lhs, const StackingOrderedChild& rhs) { return int(lhs.order) < int(rhs.order); });
 
-	// Add the list of ordered children into the stacking context in order.
+	// Add the list of ordered children into the stacking context in order. Children establishing their own local
+	// stacking context are not included here.
 	for (size_t i = 0; i < ordered_children.size(); ++i)
 	{
-		new_stacking_context->push_back(ordered_children[i].element);
+		Element* element = ordered_children[i].element;
+		new_stacking_context->push_back(element);
 
-		if (ordered_children[i].include_children)
-			ordered_children[i].element->BuildStackingContext(new_stacking_context);
-	}
-}
-
-void Element::BuildStackingContextForTable(Vector<StackingOrderedChild>& ordered_children, Element* parent)
-{
-	const size_t num_children = parent->children.size();
-
-	for (size_t i = 0; i < num_children; ++i)
-	{
-		Element* child = parent->children[i].get();
-
-		if (!child->IsVisible())
-			continue;
-
-		ordered_children.emplace_back();
-		StackingOrderedChild& ordered_child = ordered_children.back();
-		ordered_child.element = child;
-		ordered_child.order = RenderOrder::Inline;
-		ordered_child.include_children = false;
-
-		bool recurse_into_children = false;
-
-		switch (child->GetDisplay())
-		{
-		case Style::Display::TableRow:
-			ordered_child.order = RenderOrder::TableRow;
-			recurse_into_children = true;
-			break;
-		case Style::Display::TableRowGroup:
-			ordered_child.order = RenderOrder::TableRowGroup;
-			recurse_into_children = true;
-			break;
-		case Style::Display::TableColumn:
-			ordered_child.order = RenderOrder::TableColumn;
-			break;
-		case Style::Display::TableColumnGroup:
-			ordered_child.order = RenderOrder::TableColumnGroup;
-			recurse_into_children = true;
-			break;
-		case Style::Display::TableCell:
-			ordered_child.order = RenderOrder::TableCell;
-			ordered_child.include_children = !child->local_stacking_context;
-			break;
-		default:
-			ordered_child.order = RenderOrder::Positioned;
-			ordered_child.include_children = !child->local_stacking_context;
-			break;
-		}
-
-		if (recurse_into_children)
-			BuildStackingContextForTable(ordered_children, child);
+		if (ordered_children[i].include_children && !element->local_stacking_context)
+			element->BuildStackingContext(new_stacking_context);
 	}
 }
 
@@ -2345,7 +2593,33 @@ void Element::DirtyStackingContext()
 	}
 
 	if (stacking_context_parent)
+	{
 		stacking_context_parent->stacking_context_dirty = true;
+		stacking_context_parent->DirtyRender();
+	}
+}
+
+void Element::DirtyHitTest()
+{
+	if (owner_document)
+		owner_document->meta->hit_test_generation += 1;
+}
+
+const HitTestGrid* Element::GetHitTestGrid()
+{
+	RMLUI_ASSERT(local_stacking_context && !stacking_context_dirty);
+
+	if (!owner_document || (int)stacking_context.size() < HitTestGrid::MinNumElements)
+		return nullptr;
+
+	if (!meta->hit_test_grid)
+		meta->hit_test_grid = MakeUnique<HitTestGrid>();
+
+	const unsigned int generation = owner_document->meta->hit_test_generation;
+	if (!meta->hit_test_grid->IsBuilt(generation))
+		meta->hit_test_grid->Build(stacking_context, generation);
+
+	return meta->hit_test_grid.get();
 }
 
 void Element::DirtyStructure()
@@ -2516,7 +2790,7 @@ void Element::HandleTransitionProperty()
 		dirty_transition = false;
 
 		// Remove all transitions that are no longer in our local list
-		const TransitionList& keep_transitions = GetComputedValues().transition;
+		const TransitionList& keep_transitions = GetComputedValues().rare->transition;
 
 		if (keep_transitions.all)
 			return;
@@ -2565,7 +2839,7 @@ void Element::HandleAnimationProperty()
 	{
 		dirty_animation = false;
 
-		const AnimationList& animation_list = meta->computed_values.animation;
+		const AnimationList& animation_list = meta->computed_values.rare->animation;
 		bool element_has_animations = (!animation_list.empty() || !animations.empty());
 		const StyleSheet* stylesheet = nullptr;
 
@@ -2632,25 +2906,26 @@ void Element::AdvanceAnimations()
 		for (auto& animation : animations)
 		{
 			Property property = animation.UpdateAndGetProperty(time, *this);
-			if (property.unit != Property::UNKNOWN)
+			if (property.unit != Property::UNKNOWN && !ApplyAnimatedProperty(animation.GetPropertyId(), property))
 				SetProperty(animation.GetPropertyId(), property);
 		}
 
 		// Move all completed animations to the end of the list
 		auto it_completed = std::partition(animations.begin(), animations.end(), [](const ElementAnimation& animation) { return !animation.IsComplete(); });
 
-		Vector<Dictionary> dictionary_list;
-		Vector<bool> is_transition;
-		dictionary_list.reserve(animations.end() - it_completed);
-		is_transition.reserve(animations.end() - it_completed);
+		if (it_completed == animations.end())
+			return;
+
+		struct CompletedAnimation {
+			PropertyId property_id;
+			bool is_transition;
+		};
+		FrameVector<CompletedAnimation> completed_animations;
+		completed_animations.reserve(animations.end() - it_completed);
 
 		for (auto it = it_completed; it != animations.end(); ++it)
 		{
-			const String& property_name = StyleSheetSpecification::GetPropertyName(it->GetPropertyId());
-
-			dictionary_list.emplace_back();
-			dictionary_list.back().emplace("property", Variant(property_name));
-			is_transition.push_back(it->IsTransition());
+			completed_animations.push_back(CompletedAnimation{it->GetPropertyId(), it->IsTransition()});
 
 			// Remove completed transition- and animation-initiated properties.
 			// Should behave like in HandleTransitionProperty() and HandleAnimationProperty() respectively.
@@ -2661,17 +2936,107 @@ void Element::AdvanceAnimations()
 		// Need to erase elements before submitting event, as iterators might be invalidated when calling external code.
 		animations.erase(it_completed, animations.end());
 
-		for (size_t i = 0; i < dictionary_list.size(); i++)
-			DispatchEvent(is_transition[i] ? EventId::Transitionend : EventId::Animationend, dictionary_list[i]);
+		for (const CompletedAnimation& completed : completed_animations)
+		{
+			Dictionary parameters;
+			parameters.emplace("property", Variant(StyleSheetSpecification::GetPropertyName(completed.property_id)));
+			DispatchEvent(completed.is_transition ? EventId::Transitionend : EventId::Animationend, parameters);
+		}
 	}
 }
 
 
 
+bool Element::ApplyAnimatedProperty(const PropertyId id, const Property& property)
+{
+	// Properties which only affect how the element is rendered, and never the layout, can have their animated values written
+	// straight into the computed values, skipping the full style resolution of the element and its children. The computed
+	// values must have been resolved at least once though.
+	if (computed_values_are_default_initialized || !IsAnimatedValueDirect(id, property))
+		return false;
+
+	if (!meta->style.SetAnimatedProperty(id, property))
+		return false;
+
+	const bool propagate = (!children.empty() && StyleSheetSpecification::GetProperty(id)->IsInherited());
+	Style::SharedValues<Style::InheritedValues> previous_values;
+	if (propagate)
+		previous_values = meta->computed_values.inherited;
+
+	WriteAnimatedValue(meta->computed_values, id, property);
+
+	PropertyIdSet changed_properties;
+	changed_properties.Insert(id);
+	OnPropertyChange(changed_properties);
+
+	if (propagate)
+		PropagateAnimatedValue(id, property, previous_values);
+
+	return true;
+}
+
+void Element::PropagateAnimatedValue(const PropertyId id, const Property& property, const Style::SharedValues<Style::InheritedValues>& previous_values)
+{
+	PropertyIdSet changed_properties;
+	changed_properties.Insert(id);
+
+	for (const ElementPtr& child : children)
+	{
+		// Children defining the property themselves are unaffected, and children yet to be computed will inherit the new value.
+		if (child->computed_values_are_default_initialized || child->meta->style.GetLocalProperty(id))
+			continue;
+
+		Style::SharedValues<Style::InheritedValues>& child_values = child->meta->computed_values.inherited;
+		const Style::SharedValues<Style::InheritedValues> child_previous_values = child_values;
+
+		// Keep sharing our inherited values with children that did so before.
+		if (child_values.IsSharedWith(previous_values))
+			child_values = meta->computed_values.inherited;
+		else
+			WriteAnimatedValue(child->meta->computed_values, id, property);
+
+		child->OnPropertyChange(changed_properties);
+		child->PropagateAnimatedValue(id, property, child_previous_values);
+	}
+}
+
 void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
 {
 	dirty_perspective |= perspective_dirty;
 	dirty_transform |= transform_dirty;
+	DirtyRender();
+}
+
+void Element::DirtyRender()
+{
+	// Our geometry is replayed as part of every ancestor's geometry, thus they all need to render again. Documents being
+	// updated in parallel stop at themselves, the context dirties the root element afterwards.
+	for (Element* element = this; element; element = element->parent)
+	{
+		element->render_dirty = true;
+		if (element == owner_document && WorkerPool::IsInParallelLoop())
+			break;
+	}
+}
+
+void Element::DirtyRenderRecursive()
+{
+	DirtyRender();
+
+	// Our ancestors are already dirtied, only the flag of each descendant needs to be set.
+	ElementList descendants;
+	for (const ElementPtr& child : children)
+		descendants.push_back(child.get());
+
+	while (!descendants.empty())
+	{
+		Element* element = descendants.back();
+		descendants.pop_back();
+
+		element->render_dirty = true;
+		for (const ElementPtr& child : element->children)
+			descendants.push_back(child.get());
+	}
 }
 
 
@@ -2693,7 +3058,7 @@ void Element::UpdateTransformState()
 		// and let the children's transform update merge it with their transform.
 		bool had_perspective = (transform_state && transform_state->GetLocalPerspective());
 
-		float distance = computed.perspective;
+		float distance = computed.rare->perspective;
 		Vector2f vanish = Vector2f(pos.x + size.x * 0.5f, pos.y + size.y * 0.5f);
 		bool have_perspective = false;
 
@@ -2702,15 +3067,15 @@ void Element::UpdateTransformState()
 			have_perspective = true;
 
 			// Compute the vanishing point from the perspective origin
-			if (computed.perspective_origin_x.type == Style::PerspectiveOrigin::Percentage)
-				vanish.x = pos.x + computed.perspective_origin_x.value * 0.01f * size.x;
+			if (computed.rare->perspective_origin_x.type == Style::PerspectiveOrigin::Percentage)
+				vanish.x = pos.x + computed.rare->perspective_origin_x.value * 0.01f * size.x;
 			else
-				vanish.x = pos.x + computed.perspective_origin_x.value;
+				vanish.x = pos.x + computed.rare->perspective_origin_x.value;
 
-			if (computed.perspective_origin_y.type == Style::PerspectiveOrigin::Percentage)
-				vanish.y = pos.y + computed.perspective_origin_y.value * 0.01f * size.y;
+			if (computed.rare->perspective_origin_y.type == Style::PerspectiveOrigin::Percentage)
+				vanish.y = pos.y + computed.rare->perspective_origin_y.value * 0.01f * size.y;
 			else
-				vanish.y = pos.y + computed.perspective_origin_y.value;
+				vanish.y = pos.y + computed.rare->perspective_origin_y.value;
 		}
 
 		if (have_perspective)
@@ -2746,13 +3111,13 @@ void Element::UpdateTransformState()
 		bool have_transform = false;
 		Matrix4f transform = Matrix4f::Identity();
 
-		if (computed.transform)
+		if (computed.rare->transform)
 		{
 			// First find the current element's transform
-			const int n = computed.transform->GetNumPrimitives();
+			const int n = computed.rare->transform->GetNumPrimitives();
 			for (int i = 0; i < n; ++i)
 			{
-				const TransformPrimitive& primitive = computed.transform->GetPrimitive(i);
+				const TransformPrimitive& primitive = computed.rare->transform->GetPrimitive(i);
 				Matrix4f matrix = TransformUtilities::ResolveTransform(primitive, *this);
 				transform *= matrix;
 				have_transform = true;
@@ -2763,17 +3128,17 @@ void Element::UpdateTransformState()
 				// Compute the transform origin
 				Vector3f transform_origin(pos.x + size.x * 0.5f, pos.y + size.y * 0.5f, 0);
 
-				if (computed.transform_origin_x.type == Style::TransformOrigin::Percentage)
-					transform_origin.x = pos.x + computed.transform_origin_x.value * size.x * 0.01f;
+				if (computed.rare->transform_origin_x.type == Style::TransformOrigin::Percentage)
+					transform_origin.x = pos.x + computed.rare->transform_origin_x.value * size.x * 0.01f;
 				else
-					transform_origin.x = pos.x + computed.transform_origin_x.value;
+					transform_origin.x = pos.x + computed.rare->transform_origin_x.value;
 
-				if (computed.transform_origin_y.type == Style::TransformOrigin::Percentage)
-					transform_origin.y = pos.y + computed.transform_origin_y.value * size.y * 0.01f;
+				if (computed.rare->transform_origin_y.type == Style::TransformOrigin::Percentage)
+					transform_origin.y = pos.y + computed.rare->transform_origin_y.value * size.y * 0.01f;
 				else
-					transform_origin.y = pos.y + computed.transform_origin_y.value;
+					transform_origin.y = pos.y + computed.rare->transform_origin_y.value;
 
-				transform_origin.z = computed.transform_origin_z;
+				transform_origin.z = computed.rare->transform_origin_z;
 
 				// Make the transformation apply relative to the transform origin
 				transform = Matrix4f::Translate(transform_origin) * transform * Matrix4f::Translate(-transform_origin);
@@ -2813,6 +3178,10 @@ void Element::UpdateTransformState()
 			transform_state->SetTransform(nullptr);
 
 		perspective_or_transform_changed |= (had_transform != have_transform);
+
+		// Transformed elements are always tested, while other elements are only tested within their boxes.
+		if (had_transform != have_transform)
+			DirtyHitTest();
 	}
 
 	// A change in perspective or transform will require an update to children transforms as well.
@@ -2832,6 +3201,7 @@ void Element::UpdateTransformState()
 void Element::OnStyleSheetChangeRecursive()
 {
 	GetElementDecoration()->DirtyDecorators();
+	DirtyRender();
 
 	OnStyleSheetChange();
 
@@ -34,6 +34,7 @@
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/Transform.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -416,6 +417,7 @@ bool ElementAnimation::InternalAddKey(float time, const Property& in_property, E
 	}
 
 	keys.emplace_back(time, in_property, tween);
+	track_components = -1;
 	bool result = true;
 
 	if (keys.back().property.unit == Property::TRANSFORM)
@@ -536,10 +538,60 @@ Property ElementAnimation::UpdateAndGetProperty(double world_time, Element& elem
 
 	float alpha = GetInterpolationFactorAndKeys(&key0, &key1);
 
+	if (track_components < 0)
+		BuildTrack();
+
+	if (track_components > 0)
+		return InterpolateTrack(key0, key1, alpha);
+
 	Property result = InterpolateProperties(keys[key0].property, keys[key1].property, alpha, element, keys[0].property.definition);
 	
 	return result;
 }
 
+void ElementAnimation::BuildTrack()
+{
+	track_values.clear();
+	track_components = 0;
+	track_unit = keys[0].property.unit;
+
+	const bool all_same_unit = std::all_of(keys.begin(), keys.end(), [this](const AnimationKey& key) { return key.property.unit == track_unit; });
+	if (!all_same_unit)
+		return;
+
+	if (track_unit & Property::NUMBER_LENGTH_PERCENT)
+	{
+		track_values.reserve(keys.size());
+		for (const AnimationKey& key : keys)
+			track_values.push_back(key.property.Get<float>());
+		track_components = 1;
+	}
+	else if (track_unit == Property::COLOUR)
+	{
+		track_values.reserve(keys.size() * 4);
+		for (const AnimationKey& key : keys)
+		{
+			const Colourf c = ColourToLinearSpace(key.property.Get<Colourb>());
+			track_values.insert(track_values.end(), {c.red, c.green, c.blue, c.alpha});
+		}
+		track_components = 4;
+	}
+}
+
+Property ElementAnimation::InterpolateTrack(int key0, int key1, float alpha) const
+{
+	const float* v0 = track_values.data() + key0 * track_components;
+	const float* v1 = track_values.data() + key1 * track_components;
+
+	float v[4];
+	for (int i = 0; i < track_components; i++)
+		v[i] = (1.0f - alpha) * v0[i] + alpha * v1[i];
+
+	if (track_components == 4)
+		return Property{ ColourFromLinearSpace(Colourf(v[0], v[1], v[2], v[3])), Property::COLOUR };
+
+	return Property{ v[0], track_unit };
+}
+
 
 } // namespace Rml
@@ -67,10 +67,20 @@ private:
 	bool animation_complete = true;
 	ElementAnimationOrigin origin = ElementAnimationOrigin::User;
 
+	// Key values stored contiguously as one float per key for numbers of a single unit, or four floats per key for colours
+	// in linear space. Lets the animation be interpolated without converting its key properties on every update.
+	Vector<float> track_values;
+	// Number of floats per key in the track, zero if the keys are interpolated as properties, or -1 if not yet built.
+	int track_components = -1;
+	Property::Unit track_unit = Property::UNKNOWN;
+
 	bool InternalAddKey(float time, const Property& property, Element& element, Tween tween);
 
 	float GetInterpolationFactorAndKeys(int* out_key0, int* out_key1) const;
 
+	void BuildTrack();
+	Property InterpolateTrack(int key0, int key1, float alpha) const;
+
 public:
 	ElementAnimation() {}
 	ElementAnimation(PropertyId property_id, ElementAnimationOrigin origin, const Property& current_value, Element& element,
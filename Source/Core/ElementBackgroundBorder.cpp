@@ -75,7 +75,7 @@ void ElementBackgroundBorder::GenerateGeometry(Element* element)
 	};
 	
 	// Apply opacity
-	const float opacity = computed.opacity;
+	const float opacity = computed.inherited->opacity;
 	background_color.alpha = (byte)(opacity * (float)background_color.alpha);
 
 	if (opacity < 1)
@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/DecoratorInstancer.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "WorkerPool.h"
 
 namespace Rml {
 
@@ -50,7 +51,9 @@ void ElementDecoration::InstanceDecorators()
 	{
 		decorators_dirty = false;
 		decorators_data_dirty = true;
-		ReloadDecorators();
+
+		// Decorator instancers are not required to be thread-safe, always instance them on the thread updating the context.
+		WorkerPool::RunOnCallingThread([this]() { ReloadDecorators(); });
 	}
 }
 
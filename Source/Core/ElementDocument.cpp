@@ -34,6 +34,7 @@
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
+#include "DocumentCache.h"
 #include "DocumentHeader.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
@@ -100,7 +101,17 @@ void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
 	// Combine any inline sheets.
 	for (const DocumentHeader::Resource& rcss : header.rcss)
 	{
-		if (rcss.is_inline)
+		if (rcss.is_inline && DocumentCache::IsEnabled())
+		{
+			if (const StyleSheetContainer* inline_sheet = DocumentCache::GetInlineStyleSheet(rcss.content, rcss.path, rcss.line))
+			{
+				if (new_style_sheet)
+					new_style_sheet->MergeStyleSheetContainer(*inline_sheet);
+				else
+					new_style_sheet = inline_sheet->CombineStyleSheetContainer(StyleSheetContainer());
+			}
+		}
+		else if (rcss.is_inline)
 		{
 			auto inline_sheet = MakeShared<StyleSheetContainer>();
 			auto stream = MakeUnique<StreamMemory>((const byte*)rcss.content.c_str(), rcss.content.size());
@@ -434,6 +445,42 @@ void ElementDocument::UpdateLayout()
 		// Ignore dirtied layout during document formatting. Layouting must not require re-iteration.
 		// In particular, scrollbars being enabled may set the dirty flag, but this case is already handled within the layout engine.
 		layout_dirty = false;
+		dirty_layout_boundaries.clear();
+	}
+	else if (!dirty_layout_boundaries.empty())
+	{
+		RMLUI_ZoneScopedN("UpdateLayout boundaries");
+
+		Vector<ObserverPtr<Element>> boundaries;
+		boundaries.swap(dirty_layout_boundaries);
+
+		for (const ObserverPtr<Element>& boundary_ptr : boundaries)
+		{
+			Element* boundary = boundary_ptr.get();
+			if (!boundary || boundary->GetOwnerDocument() != this || !LayoutEngine::IsLayoutBoundary(boundary))
+				continue;
+
+			// Boundaries within another dirty boundary are formatted along with it.
+			bool is_nested = false;
+			for (Element* ancestor = boundary->GetParentNode(); ancestor && ancestor != this && !is_nested; ancestor = ancestor->GetParentNode())
+			{
+				for (const ObserverPtr<Element>& other : boundaries)
+				{
+					if (other.get() == ancestor)
+					{
+						is_nested = true;
+						break;
+					}
+				}
+			}
+
+			if (!is_nested)
+				LayoutEngine::FormatLayoutBoundary(boundary);
+		}
+
+		// As with formatting the whole document, layout changes made during formatting are ignored.
+		layout_dirty = false;
+		dirty_layout_boundaries.clear();
 	}
 }
 
@@ -488,7 +535,22 @@ void ElementDocument::DirtyLayout()
 
 bool ElementDocument::IsLayoutDirty()
 {
-	return layout_dirty;
+	return layout_dirty || !dirty_layout_boundaries.empty();
+}
+
+void ElementDocument::DirtyLayoutBoundary(Element* element)
+{
+	RMLUI_ASSERT(element && element != this);
+	if (layout_dirty)
+		return;
+
+	for (const ObserverPtr<Element>& boundary : dirty_layout_boundaries)
+	{
+		if (boundary.get() == element)
+			return;
+	}
+
+	dirty_layout_boundaries.push_back(element->GetObserverPtr());
 }
 
 void ElementDocument::DirtyVwAndVhProperties()
@@ -540,7 +602,7 @@ void ElementDocument::ProcessDefaultAction(Event& event)
 		{
 			Element* focus_node = GetFocusLeafNode();
 
-			if (focus_node && focus_node->GetComputedValues().tab_index == Style::TabIndex::Auto)
+			if (focus_node && focus_node->GetComputedValues().rare->tab_index == Style::TabIndex::Auto)
 			{
 				focus_node->Click();
 				event.StopPropagation();
@@ -562,10 +624,10 @@ static CanFocus CanFocusElement(Element* element)
 
 	const ComputedValues& computed = element->GetComputedValues();
 
-	if (computed.focus == Style::Focus::None)
+	if (computed.inherited->focus == Style::Focus::None)
 		return CanFocus::NoAndNoChildren;
 
-	if (computed.tab_index == Style::TabIndex::Auto)
+	if (computed.rare->tab_index == Style::TabIndex::Auto)
 		return CanFocus::Yes;
 
 	return CanFocus::No;
@@ -173,7 +173,7 @@ void ElementScroll::FormatScrollbars()
 		}
 
 		float slider_length = containing_block[1 - i];
-		float user_scrollbar_margin = scrollbars[i].element->GetComputedValues().scrollbar_margin;
+		float user_scrollbar_margin = scrollbars[i].element->GetComputedValues().rare->scrollbar_margin;
 		float min_scrollbar_margin = GetScrollbarSize(i == VERTICAL ? HORIZONTAL : VERTICAL);
 		slider_length -= Math::Max(user_scrollbar_margin, min_scrollbar_margin);
 
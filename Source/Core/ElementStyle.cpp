@@ -339,6 +339,19 @@ bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 	return true;
 }
 
+bool ElementStyle::SetAnimatedProperty(PropertyId id, const Property& property)
+{
+	Property new_property = property;
+
+	new_property.definition = StyleSheetSpecification::GetProperty(id);
+	if (!new_property.definition)
+		return false;
+
+	inline_properties.SetProperty(id, new_property);
+
+	return true;
+}
+
 // Removes a local property override on the element.
 void ElementStyle::RemoveProperty(PropertyId id)
 {
@@ -370,14 +383,14 @@ const PropertyMap& ElementStyle::GetLocalStyleProperties() const
 
 static float ComputeLength(const Property* property, Element* element)
 {
-	const float font_size = element->GetComputedValues().font_size;
-	float doc_font_size = DefaultComputedValues.font_size;
+	const float font_size = element->GetComputedValues().inherited->font_size;
+	float doc_font_size = DefaultComputedValues.inherited->font_size;
 	float dp_ratio = 1.0f;
 	Vector2f vp_dimensions(1.0f);
 
 	if (ElementDocument* document = element->GetOwnerDocument())
 	{
-		doc_font_size = document->GetComputedValues().font_size;
+		doc_font_size = document->GetComputedValues().inherited->font_size;
 
 		if (Context* context = document->GetContext())
 		{
@@ -432,12 +445,12 @@ float ElementStyle::ResolveLength(const Property* property, RelativeTarget relat
 		base_value = element->GetContainingBlock().y;
 		break;
 	case RelativeTarget::FontSize:
-		base_value = element->GetComputedValues().font_size;
+		base_value = element->GetComputedValues().inherited->font_size;
 		break;
 	case RelativeTarget::ParentFontSize:
 	{
 		auto p = element->GetParentNode();
-		base_value = (p ? p->GetComputedValues().font_size : DefaultComputedValues.font_size);
+		base_value = (p ? p->GetComputedValues().inherited->font_size : DefaultComputedValues.inherited->font_size);
 	}
 		break;
 	case RelativeTarget::LineHeight:
@@ -557,8 +570,8 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 	//   3. Assign any local properties (from inline style or stylesheet)
 	//   4. Dirty properties in children that are inherited
 
-	const float font_size_before = values.font_size;
-	const Style::LineHeight line_height_before = values.line_height;
+	const float font_size_before = values.inherited->font_size;
+	const Style::LineHeight line_height_before = values.inherited->line_height;
 
 	// The next flag is just a small optimization, if the element was just created we don't need to copy all the default values.
 	if (!values_are_default_initialized)
@@ -570,82 +583,68 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		values = DefaultComputedValues;
 	}
 
+	// Inherited properties are shared with the parent, but the group is copied below as soon as any of them are
+	// locally defined. Line-height and font-size are computed first.
+	if (parent_values)
+		values.inherited = parent_values->inherited;
+
 	bool dirty_em_properties = false;
 
 	// Always do font-size first if dirty, because of em-relative values
+	float font_size = font_size_before;
 	if(dirty_properties.Contains(PropertyId::FontSize))
 	{
 		if (auto p = GetLocalProperty(PropertyId::FontSize))
-			values.font_size = ComputeFontsize(*p, values, parent_values, document_values, dp_ratio, vp_dimensions);
+			font_size = ComputeFontsize(*p, values, parent_values, document_values, dp_ratio, vp_dimensions);
 		else if (parent_values)
-			values.font_size = parent_values->font_size;
+			font_size = parent_values->inherited->font_size;
+		else
+			font_size = DefaultComputedValues.inherited->font_size;
 		
-		if (font_size_before != values.font_size)
+		if (font_size_before != font_size)
 		{
 			dirty_em_properties = true;
 			dirty_properties.Insert(PropertyId::LineHeight);
 		}
 	}
-	else
-	{
-		values.font_size = font_size_before;
-	}
 
-	const float font_size = values.font_size;
-	const float document_font_size = (document_values ? document_values->font_size : DefaultComputedValues.font_size);
+	if (values.inherited->font_size != font_size)
+		values.inherited.Write().font_size = font_size;
+
+	const float document_font_size = (document_values ? document_values->inherited->font_size : DefaultComputedValues.inherited->font_size);
 
 
 	// Since vertical-align depends on line-height we compute this before iteration
+	Style::LineHeight line_height = line_height_before;
 	if(dirty_properties.Contains(PropertyId::LineHeight))
 	{
 		if (auto p = GetLocalProperty(PropertyId::LineHeight))
 		{
-			values.line_height = ComputeLineHeight(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			line_height = ComputeLineHeight(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 		}
 		else if (parent_values)
 		{
 			// Line height has a special inheritance case for numbers/percent: they inherit them directly instead of computed length, but for lengths, they inherit the length.
 			// See CSS specs for details. Percent is already converted to number.
-			if (parent_values->line_height.inherit_type == Style::LineHeight::Number)
-				values.line_height = Style::LineHeight(font_size * parent_values->line_height.inherit_value, Style::LineHeight::Number, parent_values->line_height.inherit_value);
+			const Style::LineHeight& parent_line_height = parent_values->inherited->line_height;
+			if (parent_line_height.inherit_type == Style::LineHeight::Number)
+				line_height = Style::LineHeight(font_size * parent_line_height.inherit_value, Style::LineHeight::Number, parent_line_height.inherit_value);
 			else
-				values.line_height = parent_values->line_height;
+				line_height = parent_line_height;
+		}
+		else
+		{
+			line_height = DefaultComputedValues.inherited->line_height;
 		}
 
-		if(line_height_before.value != values.line_height.value || line_height_before.inherit_value != values.line_height.inherit_value)
+		if(line_height_before.value != line_height.value || line_height_before.inherit_value != line_height.inherit_value)
 			dirty_properties.Insert(PropertyId::VerticalAlign);
 	}
-	else
-	{
-		values.line_height = line_height_before;
-	}
 
-
-	if (parent_values)
-	{
-		// Inherited properties are copied here, but may be overwritten below by locally defined properties
-		// Line-height and font-size are computed above
-		values.color = parent_values->color;
-		values.opacity = parent_values->opacity;
-
-		values.font_family = parent_values->font_family;
-		values.font_style = parent_values->font_style;
-		values.font_weight = parent_values->font_weight;
-		values.font_face_handle = parent_values->font_face_handle;
-
-		values.text_align = parent_values->text_align;
-		values.text_decoration = parent_values->text_decoration;
-		values.text_transform = parent_values->text_transform;
-		values.white_space = parent_values->white_space;
-		values.word_break = parent_values->word_break;
-
-		values.cursor = parent_values->cursor;
-		values.focus = parent_values->focus;
-
-		values.pointer_events = parent_values->pointer_events;
-		
-		values.has_font_effect = parent_values->has_font_effect;
-	}
+	const Style::LineHeight& current_line_height = values.inherited->line_height;
+	if (current_line_height.value != line_height.value || current_line_height.inherit_type != line_height.inherit_type ||
+		current_line_height.inherit_value != line_height.inherit_value)
+		values.inherited.Write().line_height = line_height;
 
 
 	for (auto it = Iterate(); !it.AtEnd(); ++it)
@@ -784,7 +783,7 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 			// (Line-height computed above)
 			break;
 		case PropertyId::VerticalAlign:
-			values.vertical_align = ComputeVerticalAlign(p, values.line_height.value, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.vertical_align = ComputeVerticalAlign(p, line_height.value, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 
 		case PropertyId::OverflowX:
@@ -804,138 +803,147 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 			values.background_color = p->Get<Colourb>();
 			break;
 		case PropertyId::Color:
-			values.color = p->Get<Colourb>();
+			values.inherited.Write().color = p->Get<Colourb>();
 			break;
 		case PropertyId::ImageColor:
-			values.image_color = p->Get<Colourb>();
+			values.rare.Write().image_color = p->Get<Colourb>();
 			break;
 		case PropertyId::Opacity:
-			values.opacity = p->Get<float>();
+			values.inherited.Write().opacity = p->Get<float>();
 			break;
 
 		case PropertyId::FontFamily:
-			values.font_family = ComputeFontFamily(p->Get<String>());
-			values.font_face_handle = 0;
+		{
+			Style::InheritedValues& inherited = values.inherited.Write();
+			inherited.font_family = ComputeFontFamily(p->Get<String>());
+			inherited.font_face_handle = 0;
+		}
 			break;
 		case PropertyId::FontStyle:
-			values.font_style = (FontStyle)p->Get< int >();
-			values.font_face_handle = 0;
+		{
+			Style::InheritedValues& inherited = values.inherited.Write();
+			inherited.font_style = (FontStyle)p->Get< int >();
+			inherited.font_face_handle = 0;
+		}
 			break;
 		case PropertyId::FontWeight:
-			values.font_weight = (FontWeight)p->Get< int >();
-			values.font_face_handle = 0;
+		{
+			Style::InheritedValues& inherited = values.inherited.Write();
+			inherited.font_weight = (FontWeight)p->Get< int >();
+			inherited.font_face_handle = 0;
+		}
 			break;
 		case PropertyId::FontSize:
 			// (font-size computed above)
-			values.font_face_handle = 0;
+			values.inherited.Write().font_face_handle = 0;
 			break;
 
 		case PropertyId::TextAlign:
-			values.text_align = (TextAlign)p->Get< int >();
+			values.inherited.Write().text_align = (TextAlign)p->Get< int >();
 			break;
 		case PropertyId::TextDecoration:
-			values.text_decoration = (TextDecoration)p->Get< int >();
+			values.inherited.Write().text_decoration = (TextDecoration)p->Get< int >();
 			break;
 		case PropertyId::TextTransform:
-			values.text_transform = (TextTransform)p->Get< int >();
+			values.inherited.Write().text_transform = (TextTransform)p->Get< int >();
 			break;
 		case PropertyId::WhiteSpace:
-			values.white_space = (WhiteSpace)p->Get< int >();
+			values.inherited.Write().white_space = (WhiteSpace)p->Get< int >();
 			break;
 		case PropertyId::WordBreak:
-			values.word_break = (WordBreak)p->Get< int >();
+			values.inherited.Write().word_break = (WordBreak)p->Get< int >();
 			break;
 
 		case PropertyId::RowGap:
-			values.row_gap = ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.rare.Write().row_gap = ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 		case PropertyId::ColumnGap:
-			values.column_gap = ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.rare.Write().column_gap = ComputeLengthPercentage(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 
 		case PropertyId::Cursor:
-			values.cursor = p->Get< String >();
+			values.inherited.Write().cursor = p->Get< String >();
 			break;
 
 		case PropertyId::Drag:
-			values.drag = (Drag)p->Get< int >();
+			values.rare.Write().drag = (Drag)p->Get< int >();
 			break;
 		case PropertyId::TabIndex:
-			values.tab_index = (TabIndex)p->Get< int >();
+			values.rare.Write().tab_index = (TabIndex)p->Get< int >();
 			break;
 		case PropertyId::Focus:
-			values.focus = (Focus)p->Get<int>();
+			values.inherited.Write().focus = (Focus)p->Get<int>();
 			break;
 		case PropertyId::ScrollbarMargin:
-			values.scrollbar_margin = ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.rare.Write().scrollbar_margin = ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 		case PropertyId::PointerEvents:
-			values.pointer_events = (PointerEvents)p->Get<int>();
+			values.inherited.Write().pointer_events = (PointerEvents)p->Get<int>();
 			break;
 
 		case PropertyId::Perspective:
-			values.perspective = ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.rare.Write().perspective = ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 		case PropertyId::PerspectiveOriginX:
-			values.perspective_origin_x = ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.rare.Write().perspective_origin_x = ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 		case PropertyId::PerspectiveOriginY:
-			values.perspective_origin_y = ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.rare.Write().perspective_origin_y = ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 
 		case PropertyId::Transform:
-			values.transform = p->Get<TransformPtr>();
+			values.rare.Write().transform = p->Get<TransformPtr>();
 			break;
 		case PropertyId::TransformOriginX:
-			values.transform_origin_x = ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.rare.Write().transform_origin_x = ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 		case PropertyId::TransformOriginY:
-			values.transform_origin_y = ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.rare.Write().transform_origin_y = ComputeOrigin(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 		case PropertyId::TransformOriginZ:
-			values.transform_origin_z = ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.rare.Write().transform_origin_z = ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 
 		case PropertyId::Transition:
-			values.transition = p->Get<TransitionList>();
+			values.rare.Write().transition = p->Get<TransitionList>();
 			break;
 		case PropertyId::Animation:
-			values.animation = p->Get<AnimationList>();
+			values.rare.Write().animation = p->Get<AnimationList>();
 			break;
 
 		case PropertyId::Decorator:
 			values.has_decorator = (p->unit == Property::DECORATOR);
 			break;
 		case PropertyId::FontEffect:
-			values.has_font_effect = (p->unit == Property::FONTEFFECT);
+			values.inherited.Write().has_font_effect = (p->unit == Property::FONTEFFECT);
 			break;
 
 		case PropertyId::AlignContent:
-			values.align_content = (AlignContent)p->Get<int>();
+			values.rare.Write().align_content = (AlignContent)p->Get<int>();
 			break;
 		case PropertyId::AlignItems:
-			values.align_items = (AlignItems)p->Get<int>();
+			values.rare.Write().align_items = (AlignItems)p->Get<int>();
 			break;
 		case PropertyId::AlignSelf:
-			values.align_self = (AlignSelf)p->Get<int>();
+			values.rare.Write().align_self = (AlignSelf)p->Get<int>();
 			break;
 		case PropertyId::FlexBasis:
-			values.flex_basis = ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions);
+			values.rare.Write().flex_basis = ComputeLengthPercentageAuto(p, font_size, document_font_size, dp_ratio, vp_dimensions);
 			break;
 		case PropertyId::FlexDirection:
-			values.flex_direction = (FlexDirection)p->Get<int>();
+			values.rare.Write().flex_direction = (FlexDirection)p->Get<int>();
 			break;
 		case PropertyId::FlexGrow:
-			values.flex_grow = p->Get<float>();
+			values.rare.Write().flex_grow = p->Get<float>();
 			break;
 		case PropertyId::FlexShrink:
-			values.flex_shrink = p->Get<float>();
+			values.rare.Write().flex_shrink = p->Get<float>();
 			break;
 		case PropertyId::FlexWrap:
-			values.flex_wrap = (FlexWrap)p->Get<int>();
+			values.rare.Write().flex_wrap = (FlexWrap)p->Get<int>();
 			break;
 		case PropertyId::JustifyContent:
-			values.justify_content = (JustifyContent)p->Get<int>();
+			values.rare.Write().justify_content = (JustifyContent)p->Get<int>();
 			break;
 
 		// Unhandled properties. Must be manually retrieved with 'GetProperty()'.
@@ -951,13 +959,59 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 	}
 
 	// The font-face handle is nulled when local font properties are set. In that case we need to retrieve a new handle.
-	if (!values.font_face_handle)
+	if (!values.inherited->font_face_handle)
 	{
 		RMLUI_ZoneScopedN("FontFaceHandle");
-		values.font_face_handle = GetFontEngineInterface()->GetFontFaceHandle(values.font_family, values.font_style, values.font_weight, (int)values.font_size);
+		const Style::InheritedValues& inherited = *values.inherited;
+		const FontFaceHandle font_face_handle = GetFontEngineInterface()->GetFontFaceHandle(inherited.font_family, inherited.font_style, inherited.font_weight, (int)inherited.font_size);
+
+		// Avoid copying the group when no font face is found, such as when no font family is set.
+		if (font_face_handle)
+			values.inherited.Write().font_face_handle = font_face_handle;
+	}
+
+	return PropagateDirtyProperties();
+}
+
+bool ElementStyle::CanShareComputedValues(const ElementStyle& other) const
+{
+	return definition == other.definition && !definition_dirty && !other.definition_dirty && other.dirty_properties.Empty() &&
+		inline_properties.GetNumProperties() == 0 && other.inline_properties.GetNumProperties() == 0;
+}
+
+PropertyIdSet ElementStyle::ShareComputedValues(Style::ComputedValues& values, const Style::ComputedValues& shared_values)
+{
+	if (dirty_properties.Empty())
+		return PropertyIdSet();
+
+	RMLUI_ZoneScopedC(0xFF7F50);
+
+	const float font_size_before = values.inherited->font_size;
+	const Style::LineHeight line_height_before = values.inherited->line_height;
+
+	values = shared_values;
+
+	// Dirty the same dependent properties as ComputeValues() would have done.
+	if (font_size_before != values.inherited->font_size)
+	{
+		dirty_properties.Insert(PropertyId::LineHeight);
+		for (auto it = Iterate(); !it.AtEnd(); ++it)
+		{
+			auto name_property_pair = *it;
+			if (name_property_pair.second.unit == Property::EM)
+				dirty_properties.Insert(name_property_pair.first);
+		}
 	}
 
-	// Next, pass inheritable dirty properties onto our children
+	if (line_height_before.value != values.inherited->line_height.value || line_height_before.inherit_value != values.inherited->line_height.inherit_value)
+		dirty_properties.Insert(PropertyId::VerticalAlign);
+
+	return PropagateDirtyProperties();
+}
+
+PropertyIdSet ElementStyle::PropagateDirtyProperties()
+{
+	// Pass inheritable dirty properties onto our children
 	PropertyIdSet dirty_inherited_properties = (dirty_properties & StyleSheetSpecification::GetRegisteredInheritedProperties());
 
 	if (!dirty_inherited_properties.Empty())
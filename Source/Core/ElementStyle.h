@@ -94,6 +94,11 @@ public:
 	/// @param[in] name The name of the new property.
 	/// @param[in] property The parsed property to set.
 	bool SetProperty(PropertyId id, const Property& property);
+	/// Sets a local property override without marking it dirty, used for animated values which are applied directly to
+	/// the computed values by the caller. The property is resolved as normal whenever the style is next computed.
+	/// @param[in] name The name of the new property.
+	/// @param[in] property The parsed property to set.
+	bool SetAnimatedProperty(PropertyId id, const Property& property);
 	/// Removes a local property override on the element; its value will revert to that defined in
 	/// the style sheet.
 	/// @param[in] name The name of the local property definition to remove.
@@ -140,6 +145,13 @@ public:
 	/// Must be called in correct order, always parent before its children.
 	PropertyIdSet ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values, const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions);
 
+	/// Returns true if this style resolves to the same computed values as the given style, assuming both elements share the same parent and document.
+	/// This is the case when they use the same definition without any inline properties, and the other style has no pending changes.
+	bool CanShareComputedValues(const ElementStyle& other) const;
+	/// Copies the computed values from an element for which CanShareComputedValues() holds, in place of ComputeValues().
+	/// Returns and clears the dirty properties, just like ComputeValues().
+	PropertyIdSet ShareComputedValues(Style::ComputedValues& values, const Style::ComputedValues& shared_values);
+
 	/// Returns an iterator for iterating the local properties of this element.
 	/// Note: Modifying the element's style invalidates its iterator.
 	PropertiesIterator Iterate() const;
@@ -151,6 +163,8 @@ private:
 	void DirtyProperty(PropertyId id);
 	// Sets a list of properties as dirty.
 	void DirtyProperties(const PropertyIdSet& properties);
+	// Passes inherited dirty properties onto our children, then returns and clears the dirty properties.
+	PropertyIdSet PropagateDirtyProperties();
 
 	static const Property* GetLocalProperty(PropertyId id, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
 	static const Property* GetProperty(PropertyId id, const Element * element, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
@@ -37,6 +37,7 @@
 #include "DataController.h"
 #include "DataModel.h"
 #include "DataView.h"
+#include "DrawListRecorder.h"
 #include "ElementStyle.h"
 #include "LayoutDetails.h"
 #include "LayoutEngine.h"
@@ -287,6 +288,12 @@ void ElementUtilities::ApplyActiveClipRegion(Context* context, RenderInterface*
 	Vector2i dimensions;
 	bool clip_enabled = context->GetActiveClipRegion(origin, dimensions);
 
+	if (DrawListRecorder* recorder = context->GetActiveDrawListRecorder())
+	{
+		recorder->SetScissorRegion(clip_enabled, origin, dimensions);
+		return;
+	}
+
 	render_interface->EnableScissorRegion(clip_enabled);
 	if (clip_enabled)
 	{
@@ -340,12 +347,13 @@ bool ElementUtilities::ApplyTransform(Element &element)
 	struct PreviousMatrix {
 		const Matrix4f* pointer; // This may be expired, dereferencing not allowed!
 		Matrix4f value;
+		bool unknown; // Set when the render interface state is unknown, e.g. after rendering a draw list.
 	};
 	static SmallUnorderedMap<RenderInterface*, PreviousMatrix> previous_matrix;
 
 	auto it = previous_matrix.find(render_interface);
 	if (it == previous_matrix.end())
-		it = previous_matrix.emplace(render_interface, PreviousMatrix{ nullptr, Matrix4f::Identity() }).first;
+		it = previous_matrix.emplace(render_interface, PreviousMatrix{ nullptr, Matrix4f::Identity(), false }).first;
 
 	RMLUI_ASSERT(it != previous_matrix.end());
 
@@ -355,13 +363,22 @@ bool ElementUtilities::ApplyTransform(Element &element)
 	if (const TransformState* state = element.GetTransformState())
 		new_transform = state->GetTransform();
 
+	// In draw-list mode, the transform is recorded instead and the draw list submits its own transforms.
+	Context* context = element.GetContext();
+	if (DrawListRecorder* recorder = (context ? context->GetActiveDrawListRecorder() : nullptr))
+	{
+		recorder->SetTransform(new_transform);
+		it->second.unknown = true;
+		return true;
+	}
+
 	// Only changed transforms are submitted.
-	if (old_transform != new_transform)
+	if (old_transform != new_transform || it->second.unknown)
 	{
 		Matrix4f& old_transform_value = it->second.value;
 
 		// Do a deep comparison as well to avoid submitting a new transform which is equal.
-		if(!old_transform || !new_transform || (old_transform_value != *new_transform))
+		if (it->second.unknown || !old_transform || !new_transform || (old_transform_value != *new_transform))
 		{
 			render_interface->SetTransform(new_transform);
 
@@ -370,6 +387,7 @@ bool ElementUtilities::ApplyTransform(Element &element)
 		}
 
 		old_transform = new_transform;
+		it->second.unknown = false;
 	}
 
 	return true;
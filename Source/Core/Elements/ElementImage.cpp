@@ -161,6 +161,7 @@ void ElementImage::OnDpRatioChange()
 {
 	texture_dirty = true;
 	DirtyLayout();
+	DirtyRender();
 }
 
 void ElementImage::OnStyleSheetChange()
@@ -169,6 +170,7 @@ void ElementImage::OnStyleSheetChange()
 	{
 		texture_dirty = true;
 		DirtyLayout();
+		DirtyRender();
 	}
 }
 
@@ -207,8 +209,8 @@ void ElementImage::GenerateGeometry()
 
 	const ComputedValues& computed = GetComputedValues();
 
-	float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
+	float opacity = computed.inherited->opacity;
+	Colourb quad_colour = computed.rare->image_color;
     quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
 	
 	Vector2f quad_size = GetBox().GetSize(Box::CONTENT).Round();
@@ -311,6 +313,7 @@ void ElementImage::UpdateRect()
 				valid_rect = true;
 				geometry_dirty = true;
 				rect_source = RectSource::Attribute;
+				DirtyRender();
 			}
 		}
 
@@ -259,8 +259,8 @@ void ElementProgress::GenerateGeometry()
 	Colourb quad_colour;
 	{
 		const ComputedValues& computed = GetComputedValues();
-		const float opacity = computed.opacity;
-		quad_colour = computed.image_color;
+		const float opacity = computed.inherited->opacity;
+		quad_colour = computed.rare->image_color;
 		quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
 	}
 
@@ -260,6 +260,7 @@ void WidgetDropDown::OnLayout()
 	value_element->SetBox(Box(size));
 
 	box_layout_dirty = true;
+	parent_element->DirtyRender();
 	value_layout_dirty = true;
 }
 
@@ -448,6 +449,7 @@ void WidgetDropDown::OnChildAdd(Element* element)
 
 	selection_dirty = true;
 	box_layout_dirty = true;
+	parent_element->DirtyRender();
 }
 
 void WidgetDropDown::OnChildRemove(Element* element)
@@ -462,6 +464,7 @@ void WidgetDropDown::OnChildRemove(Element* element)
 
 	selection_dirty = true;
 	box_layout_dirty = true;
+	parent_element->DirtyRender();
 }
 
 void WidgetDropDown::AttachScrollEvent()
@@ -617,6 +620,7 @@ void WidgetDropDown::ShowSelectBox(bool show)
 		value_element->SetPseudoClass("checked", true);
 		button_element->SetPseudoClass("checked", true);
 		box_layout_dirty = true;
+		parent_element->DirtyRender();
 		AttachScrollEvent();
 	}
 	else
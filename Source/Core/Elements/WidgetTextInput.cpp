@@ -193,7 +193,7 @@ void WidgetTextInput::UpdateSelectionColours()
 		colour = colour_property->Get< Colourb >();
 	else
 	{
-		colour = parent->GetComputedValues().color;
+		colour = parent->GetComputedValues().inherited->color;
 		colour.red = 255 - colour.red;
 		colour.green = 255 - colour.green;
 		colour.blue = 255 - colour.blue;
@@ -228,6 +228,7 @@ void WidgetTextInput::OnUpdate()
 		{
 			cursor_timer += CURSOR_BLINK_TIME;
 			cursor_visible = !cursor_visible;
+			parent->DirtyRender();
 		}
 	}
 }
@@ -880,6 +881,8 @@ int WidgetTextInput::CalculateCharacterIndex(int line_index, float position)
 // Shows or hides the cursor.
 void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 {
+	parent->DirtyRender();
+
 	if (show)
 	{
 		cursor_visible = true;
@@ -986,6 +989,7 @@ Vector2f WidgetTextInput::FormatText()
 	// Clear the selection background geometry, and get the vertices and indices so the new geo can
 	// be generated.
 	selection_geometry.Release(true);
+	parent->DirtyRender();
 	Vector< Vertex >& selection_vertices = selection_geometry.GetVertices();
 	Vector< int >& selection_indices = selection_geometry.GetIndices();
 
@@ -1144,7 +1148,7 @@ void WidgetTextInput::GenerateCursor()
 	cursor_size.x = Math::RoundFloat( ElementUtilities::GetDensityIndependentPixelRatio(text_element) );
 	cursor_size.y = text_element->GetLineHeight() + 2.0f;
 
-	Colourb color = parent->GetComputedValues().color;
+	Colourb color = parent->GetComputedValues().inherited->color;
 
 	if (const Property* property = parent->GetProperty(PropertyId::CaretColor))
 	{
@@ -1153,6 +1157,7 @@ void WidgetTextInput::GenerateCursor()
 	}
 
 	GeometryUtilities::GenerateQuad(&vertices[0], &indices[0], Vector2f(0, 0), cursor_size, color);
+	parent->DirtyRender();
 }
 
 void WidgetTextInput::UpdateCursorPosition()
@@ -1162,6 +1167,7 @@ void WidgetTextInput::UpdateCursorPosition()
 
 	cursor_position.x = (float) ElementUtilities::GetStringWidth(text_element, lines[cursor_line_index].content.substr(0, cursor_character_index));
 	cursor_position.y = -1.f + (float)cursor_line_index * text_element->GetLineHeight();
+	parent->DirtyRender();
 }
 
 // Expand the text selection to the position of the cursor.
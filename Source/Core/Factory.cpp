@@ -62,6 +62,7 @@
 #include "DecoratorTiledVerticalInstancer.h"
 #include "DecoratorNinePatch.h"
 #include "DecoratorGradient.h"
+#include "DocumentCache.h"
 #include "ElementHandle.h"
 #include "EventInstancerDefault.h"
 #include "FontEffectBlur.h"
@@ -72,6 +73,7 @@
 #include "StreamFile.h"
 #include "StyleSheetFactory.h"
 #include "TemplateCache.h"
+#include "WorkerPool.h"
 #include "XMLNodeHandlerBody.h"
 #include "XMLNodeHandlerDefault.h"
 #include "XMLNodeHandlerHead.h"
@@ -358,6 +360,14 @@ ElementInstancer* Factory::GetElementInstancer(const String& tag)
 // Instances a single element.
 ElementPtr Factory::InstanceElement(Element* parent, const String& instancer_name, const String& tag, const XMLAttributes& attributes)
 {
+	// Elements are always instanced on the thread updating the context, as instancers are not required to be thread-safe.
+	if (WorkerPool::IsInParallelLoop())
+	{
+		ElementPtr element;
+		WorkerPool::RunOnCallingThread([&]() { element = InstanceElement(parent, instancer_name, tag, attributes); });
+		return element;
+	}
+
 	if (ElementInstancer* instancer = GetElementInstancer(instancer_name))
 	{
 		if (ElementPtr element = instancer->InstanceElement(parent, tag, attributes))
@@ -497,6 +507,13 @@ ElementPtr Factory::InstanceDocumentStream(Context* context, Stream* stream, con
 	return element;
 }
 
+// Compiles the RML stream into the binary format.
+bool Factory::CompileDocumentStream(Stream* stream, Stream* output)
+{
+	XMLParser parser(nullptr);
+	return parser.Compile(stream, output);
+}
+
 
 // Registers an instancer that will be used to instance decorators.
 void Factory::RegisterDecoratorInstancer(const String& name, DecoratorInstancer* instancer)
@@ -570,6 +587,22 @@ void Factory::ClearTemplateCache()
 	TemplateCache::Clear();
 }
 
+void Factory::EnableDocumentCache(bool enable)
+{
+	DocumentCache::SetEnabled(enable);
+}
+
+bool Factory::PreloadDocument(const String& document_path)
+{
+	return DocumentCache::PreloadDocument(document_path);
+}
+
+// Clears the document cache. This will force documents to be reloaded.
+void Factory::ClearDocumentCache()
+{
+	DocumentCache::Clear();
+}
+
 // Registers an instancer for all RmlEvents
 void Factory::RegisterEventInstancer(EventInstancer* instancer)
 {
@@ -44,58 +44,68 @@ FontEngineInterfaceDefault::~FontEngineInterfaceDefault()
 
 bool FontEngineInterfaceDefault::LoadFontFace(const String& file_name, bool fallback_face)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	return FontProvider::LoadFontFace(file_name, fallback_face);
 }
 
 bool FontEngineInterfaceDefault::LoadFontFace(const byte* data, int data_size, const String& font_family, Style::FontStyle style, Style::FontWeight weight, bool fallback_face)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	return FontProvider::LoadFontFace(data, data_size, font_family, style, weight, fallback_face);
 }
 
 FontFaceHandle FontEngineInterfaceDefault::GetFontFaceHandle(const String& family, Style::FontStyle style, Style::FontWeight weight, int size)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	auto handle = FontProvider::GetFontFaceHandle(family, style, weight, size);
 	return reinterpret_cast<FontFaceHandle>(handle);
 }
 	
 FontEffectsHandle FontEngineInterfaceDefault::PrepareFontEffects(FontFaceHandle handle, const FontEffectList& font_effects)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
 	return (FontEffectsHandle)handle_default->GenerateLayerConfiguration(font_effects);
 }
 
 int FontEngineInterfaceDefault::GetSize(FontFaceHandle handle)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
 	return handle_default->GetSize();
 }
 
 int FontEngineInterfaceDefault::GetXHeight(FontFaceHandle handle)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
 	return handle_default->GetXHeight();
 }
 
 int FontEngineInterfaceDefault::GetLineHeight(FontFaceHandle handle)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
 	return handle_default->GetLineHeight();
 }
 
 int FontEngineInterfaceDefault::GetBaseline(FontFaceHandle handle)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
 	return handle_default->GetBaseline();
 }
 
 float FontEngineInterfaceDefault::GetUnderline(FontFaceHandle handle, float& thickness)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
 	return handle_default->GetUnderline(thickness);
 }
 
 int FontEngineInterfaceDefault::GetStringWidth(FontFaceHandle handle, const String& string, Character prior_character)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
 	return handle_default->GetStringWidth(string, prior_character);
 }
@@ -103,12 +113,14 @@ int FontEngineInterfaceDefault::GetStringWidth(FontFaceHandle handle, const Stri
 int FontEngineInterfaceDefault::GenerateString(FontFaceHandle handle, FontEffectsHandle font_effects_handle, const String& string,
 	const Vector2f& position, const Colourb& colour, float opacity, GeometryList& geometry)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
 	return handle_default->GenerateString(geometry, string, position, colour, opacity, (int)font_effects_handle);
 }
 
 int FontEngineInterfaceDefault::GetVersion(FontFaceHandle handle)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault*>(handle);
 	return handle_default->GetVersion();
 }
@@ -29,6 +29,7 @@
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTENGINEINTERFACEDEFAULT_H
 
 #include "../../../Include/RmlUi/Core/FontEngineInterface.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -74,6 +75,10 @@ public:
 
 	/// Returns the current version of the font face.
 	int GetVersion(FontFaceHandle handle) override;
+
+private:
+	// Serialises all calls, as documents may be formatted in parallel while sharing font face handles.
+	std::mutex mutex;
 };
 
 } // namespace Rml
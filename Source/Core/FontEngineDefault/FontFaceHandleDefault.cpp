@@ -297,6 +297,11 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 	// Cull any excess geometry from a previous generation.
 	geometry.resize(geometry_index);
 
+	// Glyphs added while generating the string are missing from the geometry. Since the version only changes when the layers
+	// are generated from scratch, we need to do so to make sure the geometry is generated again.
+	if (is_layers_dirty)
+		is_layers_regeneration_required = true;
+
 	return line_width;
 }
 
@@ -304,18 +309,38 @@ bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
 	bool result = false;
 
-	// If we are dirty, regenerate all the layers and increment the version
+	// If we are dirty, add the new glyphs to all the layers.
 	if(is_layers_dirty && base_layer)
 	{
 		is_layers_dirty = false;
-		++version;
 
-		// Regenerate all the layers.
-		// Note: The layer regeneration needs to happen in the order in which the layers were created,
-		// otherwise we may end up cloning a layer which has not yet been regenerated. This means trouble!
-		for (auto& pair : layers)
+		// Note: The layers need to be updated in the order in which they were created,
+		// otherwise we may end up cloning a layer which has not yet been updated. This means trouble!
+		bool appended_glyphs = !is_layers_regeneration_required;
+		if (appended_glyphs)
 		{
-			GenerateLayer(pair.layer.get());
+			// Existing glyphs keep their place in the layers' textures, thus we don't need to increment the version since
+			// previously generated geometry stays valid.
+			for (auto& pair : layers)
+			{
+				if (!GenerateLayer(pair.layer.get(), true))
+				{
+					appended_glyphs = false;
+					break;
+				}
+			}
+		}
+
+		if (!appended_glyphs)
+		{
+			// Regenerate all the layers and increment the version.
+			is_layers_regeneration_required = false;
+			++version;
+
+			for (auto& pair : layers)
+			{
+				GenerateLayer(pair.layer.get());
+			}
 		}
 
 		result = true;
@@ -467,7 +492,7 @@ FontFaceLayer* FontFaceHandleDefault::GetOrCreateLayer(const SharedPtr<const Fon
 	return layer.get();
 }
 
-bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
+bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer, bool append_glyphs)
 {
 	RMLUI_ASSERT(layer);
 	const FontEffect* font_effect = layer->GetFontEffect();
@@ -475,7 +500,7 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 
 	if (!font_effect)
 	{
-		result = layer->Generate(this);
+		result = (append_glyphs ? layer->AppendGlyphs(this) : layer->Generate(this));
 	}
 	else
 	{
@@ -497,8 +522,11 @@ bool FontFaceHandleDefault::GenerateLayer(FontFaceLayer* layer)
 				clone = cache_iterator->second;
 		}
 
-		// Create a new layer.
-		result = layer->Generate(this, clone, clone_glyph_origins);
+		// Create a new layer, or add the new glyphs to it.
+		if (append_glyphs)
+			result = layer->AppendGlyphs(this, clone, clone_glyph_origins);
+		else
+			result = layer->Generate(this, clone, clone_glyph_origins);
 
 		// Cache the layer in the layer cache if it generated its own textures (ie, didn't clone).
 		if (!clone)
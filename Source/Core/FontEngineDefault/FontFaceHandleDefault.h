@@ -116,14 +116,14 @@ private:
 	/// @return The font glyph for the returned code point.
 	const FontGlyph* GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts = true);
 
-	// Regenerate layers if dirty, such as after adding new glyphs.
+	// Update layers if dirty, such as after adding new glyphs.
 	bool UpdateLayersOnDirty();
 
 	// Create a new layer from the given font effect if it does not already exist.
 	FontFaceLayer* GetOrCreateLayer(const SharedPtr<const FontEffect>& font_effect);
 
-	// (Re-)generate a layer in this font face handle.
-	bool GenerateLayer(FontFaceLayer* layer);
+	// (Re-)generate a layer in this font face handle, or add any new glyphs to it.
+	bool GenerateLayer(FontFaceLayer* layer, bool append_glyphs = false);
 
 	FontGlyphMap glyphs;
 
@@ -150,6 +150,8 @@ private:
 
 	bool has_kerning = false;
 	bool is_layers_dirty = false;
+	// Set when the layers need to be generated from scratch on the next update, instead of only adding the new glyphs.
+	bool is_layers_regeneration_required = false;
 	int version = 0;
 
 	// All configurations currently in use on this handle. New configurations will be generated as required.
@@ -28,10 +28,87 @@
 
 #include "FontFaceLayer.h"
 #include "FontFaceHandleDefault.h"
+#include "../TextureDatabase.h"
+#include "../WorkerPool.h"
+#include <algorithm>
 #include <string.h>
 
 namespace Rml {
 
+// The inputs and result of a texture generated on the worker pool. The worker thread only reads the glyphs and writes the
+// texture data, while the remaining members are only accessed on the main thread.
+struct FontFaceLayer::TextureJob {
+	struct GlyphEntry {
+		Vector2i position;
+		Vector2i dimensions;
+		// A copy of the glyph with its own bitmap data, as the handle's glyphs may change while the job is running.
+		FontGlyph glyph;
+	};
+
+	// The layer to publish the texture to, cleared if the job is cancelled.
+	FontFaceLayer* layer = nullptr;
+	const FontFaceHandleDefault* handle = nullptr;
+	int handle_version = 0;
+	int texture_index = 0;
+
+	SharedPtr<const FontEffect> effect;
+	Vector<GlyphEntry> glyphs;
+
+	Vector2i texture_dimensions;
+	UniquePtr<const byte[]> texture_data;
+};
+
+// Allocates texture data cleared to transparent white.
+static UniquePtr<byte[]> AllocateTextureData(Vector2i dimensions)
+{
+	UniquePtr<byte[]> texture_data(new byte[dimensions.x * dimensions.y * 4]);
+
+	for (int i = 0; i < dimensions.x * dimensions.y; i++)
+		((unsigned int*)(texture_data.get()))[i] = 0x00ffffff;
+
+	return texture_data;
+}
+
+// Writes the glyph, or the glyph's effect if any, into its rectangle of a texture.
+static void RenderGlyphToTexture(byte* destination, int destination_stride, Vector2i box_dimensions, const FontGlyph& glyph,
+	const FontEffect* effect)
+{
+	if (effect == nullptr)
+	{
+		// Copy the glyph's bitmap data into its allocated texture.
+		if (glyph.bitmap_data)
+		{
+			const byte* source = glyph.bitmap_data;
+			const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+
+			for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			{
+				switch (glyph.color_format)
+				{
+				case ColorFormat::A8:
+				{
+					for (int k = 0; k < num_bytes_per_line; ++k)
+						destination[k * 4 + 3] = source[k];
+				}
+				break;
+				case ColorFormat::RGBA8:
+				{
+					memcpy(destination, source, num_bytes_per_line);
+				}
+				break;
+				}
+
+				destination += destination_stride;
+				source += num_bytes_per_line;
+			}
+		}
+	}
+	else
+	{
+		effect->GenerateGlyphTexture(destination, box_dimensions, destination_stride, glyph);
+	}
+}
+
 FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colour(255, 255, 255)
 {
 	effect = _effect;
@@ -40,140 +117,293 @@ FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colou
 }
 
 FontFaceLayer::~FontFaceLayer()
-{}
+{
+	CancelTextureJobs();
+}
 
-bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
+bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, FontFaceLayer* clone, bool clone_glyph_origins)
 {
 	// Clear the old layout if it exists.
-	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
-		texture_layout = TextureLayout{};
-		character_boxes.clear();
-		textures.clear();
-	}
+	CancelTextureJobs();
+	texture_layout = TextureLayout{};
+	character_boxes.clear();
+	textures.clear();
+
+	// Generate the new layout.
+	return AppendGlyphs(handle, clone, clone_glyph_origins);
+}
 
+bool FontFaceLayer::AppendGlyphs(const FontFaceHandleDefault* handle, FontFaceLayer* clone, bool clone_glyph_origins)
+{
 	const FontGlyphMap& glyphs = handle->GetGlyphs();
 
-	// Generate the new layout.
 	if (clone)
 	{
-		// Clone the geometry and textures from the clone layer.
-		character_boxes = clone->character_boxes;
+		// Clone the geometry of any new characters from the clone layer.
+		for (auto& pair : clone->character_boxes)
+		{
+			const Character character = pair.first;
+			if (character_boxes.find(character) != character_boxes.end())
+				continue;
 
-		// Copy the cloned layer's textures.
-		for (size_t i = 0; i < clone->textures.size(); ++i)
-			textures.push_back(clone->textures[i]);
+			TextureBox box = pair.second;
 
-		// Request the effect (if we have one) and adjust the origins as appropriate.
-		if (effect && !clone_glyph_origins)
-		{
-			for (auto& pair : glyphs)
+			// Request the effect (if we have one) and adjust the origins as appropriate.
+			if (effect && !clone_glyph_origins)
 			{
-				Character character = pair.first;
-				const FontGlyph& glyph = pair.second;
-
-				auto it = character_boxes.find(character);
-				if (it == character_boxes.end())
+				auto it_glyph = glyphs.find(character);
+				if (it_glyph != glyphs.end())
 				{
-					// This can happen if the layers have been dirtied in FontHandleDefault. We will
-					// probably be regenerated soon, just skip the character for now.
-					continue;
-				}
+					Vector2i glyph_origin = Vector2i(box.origin);
+					Vector2i glyph_dimensions = Vector2i(box.dimensions);
 
-				TextureBox& box = it->second;
+					if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, it_glyph->second))
+						box.origin = Vector2f(glyph_origin);
+					else
+						box.texture_index = -1;
+				}
+			}
 
-				Vector2i glyph_origin = Vector2i(box.origin);
-				Vector2i glyph_dimensions = Vector2i(box.dimensions);
+			character_boxes[character] = box;
+		}
 
-				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					box.origin = Vector2f(glyph_origin);
-				else
-					box.texture_index = -1;
-			}
+		// Copy the cloned layer's textures, they may have been generated again with the new characters. The texture objects
+		// are assigned in-place since they are referred to by existing geometry.
+		for (size_t i = 0; i < clone->textures.size(); ++i)
+		{
+			if (i < textures.size())
+				*textures[i] = *clone->textures[i];
+			else
+				textures.push_back(MakeUnique<Texture>(*clone->textures[i]));
 		}
+
+		// The cloned layer's textures may still be pending, then we need to copy them again once they are published.
+		if (std::find(clone->cloned_layers.begin(), clone->cloned_layers.end(), this) == clone->cloned_layers.end())
+			clone->cloned_layers.push_back(this);
+
+		return true;
 	}
-	else
+
+	// While the layer is still growing rapidly, rather generate it from scratch which packs the glyphs more tightly into fewer
+	// textures. Since that also requires all geometry to be generated again, it is only done whenever the layer doubles in size.
+	const size_t num_new_glyphs = glyphs.size() - character_boxes.size();
+	if (!character_boxes.empty() && num_new_glyphs > character_boxes.size())
+		return false;
+
+	// Add the new characters to the texture layout.
+	const int first_new_rectangle = texture_layout.GetNumRectangles();
+
+	character_boxes.reserve(glyphs.size());
+	for (auto& pair : glyphs)
 	{
-		// Initialise the texture layout for the glyphs.
-		character_boxes.reserve(glyphs.size());
-		for (auto& pair : glyphs)
+		Character character = pair.first;
+		const FontGlyph& glyph = pair.second;
+
+		auto it_box = character_boxes.find(character);
+		if (it_box != character_boxes.end())
+			continue;
+
+		TextureBox& box = character_boxes[character];
+
+		Vector2i glyph_origin(0, 0);
+		Vector2i glyph_dimensions = glyph.bitmap_dimensions;
+
+		// Adjust glyph origin / dimensions for the font effect. Glyphs not rendered by the effect are left without a texture.
+		if (effect)
 		{
-			Character character = pair.first;
-			const FontGlyph& glyph = pair.second;
+			if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+				continue;
+		}
 
-			Vector2i glyph_origin(0, 0);
-			Vector2i glyph_dimensions = glyph.bitmap_dimensions;
+		box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
+		box.dimensions = Vector2f(glyph_dimensions);
 
-			// Adjust glyph origin / dimensions for the font effect.
-			if (effect)
-			{
-				if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					continue;
-			}
+		RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
 
-			TextureBox box;
-			box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
-			box.dimensions = Vector2f(glyph_dimensions);
-			
-			RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
+		// Add the character's dimensions into the texture layout engine.
+		texture_layout.AddRectangle((int)character, glyph_dimensions);
+	}
 
-			character_boxes[character] = box;
+	if (first_new_rectangle == texture_layout.GetNumRectangles())
+		return true;
 
-			// Add the character's dimensions into the texture layout engine.
-			texture_layout.AddRectangle((int)character, glyph_dimensions);
-		}
+	constexpr int max_texture_dimensions = 1024;
+	// When glyphs are added after the initial generation, new textures are made large enough to hold further glyphs.
+	constexpr int min_appended_texture_dimensions = 256;
 
-		constexpr int max_texture_dimensions = 1024;
+	const int num_previous_textures = texture_layout.GetNumTextures();
+	const bool is_appending = (num_previous_textures > 0);
 
-		// Generate the texture layout; this will position the glyph rectangles efficiently and
-		// allocate the texture data ready for writing.
-		if (!texture_layout.GenerateLayout(max_texture_dimensions))
-			return false;
+	// Generate the texture layout; this will position the new glyph rectangles efficiently and
+	// allocate the texture data ready for writing.
+	if (!texture_layout.GenerateLayout(max_texture_dimensions, is_appending ? min_appended_texture_dimensions : 0))
+		return false;
 
+	// Iterate over each new rectangle in the layout, generating the geometry of its character.
+	Vector<bool> texture_dirty(texture_layout.GetNumTextures(), false);
 
-		// Iterate over each rectangle in the layout, copying the glyph data into the rectangle as
-		// appropriate and generating geometry.
-		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
-		{
-			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
-			Character character = (Character)rectangle.GetId();
-			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-			TextureBox& box = character_boxes[character];
-
-			// Set the character's texture index.
-			box.texture_index = rectangle.GetTextureIndex();
-
-			// Generate the character's texture coordinates.
-			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
-			box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
-			box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
-			box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
-		}
+	for (int i = first_new_rectangle; i < texture_layout.GetNumRectangles(); ++i)
+	{
+		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+		const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
+		Character character = (Character)rectangle.GetId();
+		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
+		TextureBox& box = character_boxes[character];
+
+		// Set the character's texture index.
+		box.texture_index = rectangle.GetTextureIndex();
+		texture_dirty[box.texture_index] = true;
 
-		const FontEffect* effect_ptr = effect.get();
-		const int handle_version = handle->GetVersion();
+		// Generate the character's texture coordinates.
+		box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
+		box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
+		box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
+		box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
+	}
 
-		// Generate the textures.
-		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+	// Generate the new textures, and the existing textures which received new glyphs, on the worker pool. New textures are
+	// rendered as transparent placeholders until their data is published, while existing textures keep their previous glyphs.
+	for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+	{
+		if (!texture_dirty[i])
+			continue;
+
+		if (i >= (int)textures.size())
 		{
-			int texture_id = i;
+			const Vector2i dimensions = texture_layout.GetTexture(i).GetDimensions();
 
-			TextureCallback texture_callback = [handle, effect_ptr, texture_id, handle_version](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
-				bool result = handle->GenerateLayerTexture(data, dimensions, effect_ptr, texture_id, handle_version);
-				return result;
+			TextureCallback placeholder_callback = [dimensions](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& out_dimensions) -> bool {
+				data = AllocateTextureData(dimensions);
+				out_dimensions = dimensions;
+				return true;
 			};
 
-			Texture texture;
-			texture.Set("font-face-layer", texture_callback);
-			textures.push_back(texture);
+			textures.push_back(MakeUnique<Texture>());
+			textures[i]->Set("font-face-layer", placeholder_callback);
 		}
+
+		SubmitTextureJob(handle, i);
 	}
 
 	return true;
 }
 
+void FontFaceLayer::SubmitTextureJob(const FontFaceHandleDefault* handle, int texture_index)
+{
+	const FontGlyphMap& glyphs = handle->GetGlyphs();
+
+	SharedPtr<TextureJob> job = MakeShared<TextureJob>();
+	job->layer = this;
+	job->handle = handle;
+	job->handle_version = handle->GetVersion();
+	job->texture_index = texture_index;
+	job->effect = effect;
+	job->texture_dimensions = texture_layout.GetTexture(texture_index).GetDimensions();
+
+	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+	{
+		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+		if (rectangle.GetTextureIndex() != texture_index)
+			continue;
+
+		const Character character = (Character)rectangle.GetId();
+		auto it_glyph = glyphs.find(character);
+		if (it_glyph == glyphs.end())
+			continue;
+
+		const FontGlyph& glyph = it_glyph->second;
+		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
+
+		TextureJob::GlyphEntry entry;
+		entry.position = rectangle.GetPosition();
+		entry.dimensions = Vector2i(character_boxes[character].dimensions);
+		entry.glyph = glyph.WeakCopy();
+
+		if (glyph.bitmap_data)
+		{
+			const size_t num_bytes = size_t(glyph.bitmap_dimensions.x * glyph.bitmap_dimensions.y * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1));
+			entry.glyph.bitmap_owned_data.reset(new byte[num_bytes]);
+			memcpy(entry.glyph.bitmap_owned_data.get(), glyph.bitmap_data, num_bytes);
+			entry.glyph.bitmap_data = entry.glyph.bitmap_owned_data.get();
+		}
+
+		job->glyphs.push_back(std::move(entry));
+	}
+
+	// Any previous job for this texture is superseded by this one.
+	if (texture_index >= (int)texture_jobs.size())
+		texture_jobs.resize(texture_index + 1);
+	if (texture_jobs[texture_index])
+		texture_jobs[texture_index]->layer = nullptr;
+	texture_jobs[texture_index] = job;
+
+	WorkerPool::Submit(
+		[job]() {
+			const Vector2i dimensions = job->texture_dimensions;
+			const int stride = dimensions.x * 4;
+			UniquePtr<byte[]> texture_data = AllocateTextureData(dimensions);
+
+			for (const TextureJob::GlyphEntry& entry : job->glyphs)
+			{
+				byte* destination = texture_data.get() + (entry.position.y * stride + entry.position.x * 4);
+				RenderGlyphToTexture(destination, stride, entry.dimensions, entry.glyph, job->effect.get());
+			}
+
+			job->texture_data = std::move(texture_data);
+		},
+		[job]() {
+			if (job->layer)
+				job->layer->PublishTexture(job);
+		});
+}
+
+void FontFaceLayer::PublishTexture(const SharedPtr<TextureJob>& job)
+{
+	const int texture_index = job->texture_index;
+	RMLUI_ASSERT(texture_index < (int)textures.size() && texture_jobs[texture_index] == job);
+
+	texture_jobs[texture_index].reset();
+	job->layer = nullptr;
+	job->glyphs.clear();
+	job->effect.reset();
+
+	// The generated data is handed over when the texture is first loaded. If the texture needs to be loaded again, such as after
+	// the render interface released its textures, it is instead generated from the handle on the main thread.
+	const FontEffect* effect_ptr = effect.get();
+
+	TextureCallback texture_callback = [job, effect_ptr](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
+		if (job->texture_data)
+		{
+			data = std::move(job->texture_data);
+			dimensions = job->texture_dimensions;
+			return true;
+		}
+		return job->handle->GenerateLayerTexture(data, dimensions, effect_ptr, job->texture_index, job->handle_version);
+	};
+
+	textures[texture_index]->Set("font-face-layer", texture_callback);
+
+	for (FontFaceLayer* cloned_layer : cloned_layers)
+	{
+		if (texture_index < (int)cloned_layer->textures.size())
+			*cloned_layer->textures[texture_index] = *textures[texture_index];
+	}
+
+	// Any recorded draw commands may refer to the released texture handles.
+	TextureDatabase::NotifyTexturesReleased();
+}
+
+void FontFaceLayer::CancelTextureJobs()
+{
+	for (SharedPtr<TextureJob>& job : texture_jobs)
+	{
+		if (job)
+			job->layer = nullptr;
+	}
+
+	texture_jobs.clear();
+}
+
 // Generates the texture data for a layer (for the texture database).
 bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
 {
@@ -182,7 +412,7 @@ bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vecto
 		return false;
 
 	// Generate the texture data.
-	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
+	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture(texture_layout);
 	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
 
 	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
@@ -201,42 +431,7 @@ bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vecto
 			continue;
 
 		const FontGlyph& glyph = it->second;
-
-		if (effect == nullptr)
-		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
-			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
-
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
-				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							destination[k * 4 + 3] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
-					source += num_bytes_per_line;
-				}
-			}
-		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
-		}
+		RenderGlyphToTexture(rectangle.GetTextureData(), rectangle.GetTextureStride(), Vector2i(box.dimensions), glyph, effect.get());
 	}
 
 	return true;
@@ -254,7 +449,7 @@ const Texture* FontFaceLayer::GetTexture(int index)
 	RMLUI_ASSERT(index >= 0);
 	RMLUI_ASSERT(index < GetNumTextures());
 
-	return &(textures[index]);
+	return textures[index].get();
 }
 
 // Returns the number of textures employed by this layer.
@@ -58,7 +58,17 @@ public:
 	/// @param[in] effect The effect to initialise the layer with.
 	/// @param[in] clone The layer to optionally clone geometry and texture data from.
 	/// @return True if the layer was generated successfully, false if not.
-	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
+	bool Generate(const FontFaceHandleDefault* handle, FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
+
+	/// Adds the glyphs of the handle which are not yet part of the layer. The new glyphs are placed in the free space of the
+	/// layer's textures or in new textures, while existing glyphs keep their texture coordinates. Thus, previously generated
+	/// geometry stays valid, and only the textures receiving new glyphs are generated again.
+	/// The texture data is generated on the worker pool. Until it is published, existing textures keep their previous
+	/// glyphs, while new textures are rendered as transparent placeholders.
+	/// @param[in] handle The handle generating this layer.
+	/// @param[in] clone The layer to optionally clone geometry and texture data from, it must already contain the new glyphs.
+	/// @return True if the glyphs were added successfully, false if the layer should be generated from scratch instead.
+	bool AppendGlyphs(const FontFaceHandleDefault* handle, FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
 
 	/// Generates the texture data for a layer (for the texture database).
 	/// @param[out] texture_data The pointer to be set to the generated texture data.
@@ -113,7 +123,14 @@ public:
 	Colourb GetColour() const;
 
 private:
+	struct TextureJob;
 
+	// Submits a job to generate the data of the given texture on the worker pool.
+	void SubmitTextureJob(const FontFaceHandleDefault* handle, int texture_index);
+	// Replaces the job's texture with the generated data, also in the layers cloning our textures.
+	void PublishTexture(const SharedPtr<TextureJob>& job);
+	// Prevents any pending jobs from publishing their textures to this layer.
+	void CancelTextureJobs();
 
 	struct TextureBox
 	{
@@ -131,7 +148,8 @@ private:
 	};
 
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
-	using TextureList = Vector<Texture>;
+	// Geometry refers to the layer's textures by pointer, thus their addresses must be stable when adding more textures.
+	using TextureList = Vector<UniquePtr<Texture>>;
 
 	SharedPtr<const FontEffect> effect;
 
@@ -140,6 +158,11 @@ private:
 	CharacterMap character_boxes;
 	TextureList textures;
 	Colourb colour;
+
+	// The pending job of each texture, if any.
+	Vector<SharedPtr<TextureJob>> texture_jobs;
+	// The layers which cloned our textures, they are updated whenever we publish a texture.
+	Vector<FontFaceLayer*> cloned_layers;
 };
 
 } // namespace Rml
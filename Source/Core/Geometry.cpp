@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "DrawListRecorder.h"
 #include "GeometryDatabase.h"
 #include <utility>
 
@@ -105,6 +106,15 @@ void Geometry::Render(Vector2f translation)
 
 	translation = translation.Round();
 
+	// In draw-list mode, the geometry is recorded and batched by the context instead of rendered immediately.
+	if (DrawListRecorder* recorder = (host_context ? host_context->GetActiveDrawListRecorder() : nullptr))
+	{
+		if (!vertices.empty() && !indices.empty())
+			recorder->AddGeometry(vertices.data(), (int)vertices.size(), indices.data(), (int)indices.size(),
+				texture ? texture->GetHandle(render_interface) : 0, translation);
+		return;
+	}
+
 	// Render our compiled geometry if possible.
 	if (compiled_geometry)
 	{
@@ -0,0 +1,166 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "HitTestGrid.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "TransformState.h"
+#include <cmath>
+#include <float.h>
+
+namespace Rml {
+
+// The maximum number of cells along each axis.
+static constexpr int MaxNumCellsPerAxis = 64;
+// Elements covering more than this fraction of the cells are placed in the global candidates instead.
+static constexpr float MaxCellCoverage = 0.25f;
+
+void HitTestGrid::Build(const ElementList& stacking_context, unsigned int generation)
+{
+	built = true;
+	built_generation = generation;
+
+	const int num_elements = (int)stacking_context.size();
+
+	bounds.resize(num_elements);
+	global_items.clear();
+	cell_items.clear();
+
+	Vector2f grid_min(FLT_MAX);
+	Vector2f grid_max(-FLT_MAX);
+	int num_bounded = 0;
+
+	for (int i = 0; i < num_elements; i++)
+	{
+		Element* element = stacking_context[i];
+		Bounds& element_bounds = bounds[i];
+
+		const TransformState* transform_state = element->GetTransformState();
+		element_bounds.bounded = !element->local_stacking_context && !(transform_state && transform_state->GetTransform());
+
+		if (!element_bounds.bounded)
+			continue;
+
+		const Vector2f position = element->GetAbsoluteOffset(Box::BORDER);
+		element_bounds.min = Vector2f(FLT_MAX);
+		element_bounds.max = Vector2f(-FLT_MAX);
+
+		for (int j = 0; j < element->GetNumBoxes(); j++)
+		{
+			Vector2f box_offset;
+			const Box& box = element->GetBox(j, box_offset);
+			const Vector2f box_min = position + box_offset;
+			const Vector2f box_max = box_min + box.GetSize(Box::BORDER);
+
+			element_bounds.min = Math::Min(element_bounds.min, box_min);
+			element_bounds.max = Math::Max(element_bounds.max, box_max);
+		}
+
+		grid_min = Math::Min(grid_min, element_bounds.min);
+		grid_max = Math::Max(grid_max, element_bounds.max);
+		num_bounded += 1;
+	}
+
+	num_cells_x = 0;
+	num_cells_y = 0;
+
+	if (num_bounded > 0)
+	{
+		// Aim for about one element per cell.
+		const int num_cells_per_axis = Math::Clamp((int)std::ceil(std::sqrt(float(num_bounded))), 1, MaxNumCellsPerAxis);
+		const Vector2f grid_size = Math::Max(grid_max - grid_min, Vector2f(1.f));
+
+		origin = grid_min;
+		num_cells_x = num_cells_per_axis;
+		num_cells_y = num_cells_per_axis;
+		inv_cell_size = Vector2f(float(num_cells_x), float(num_cells_y)) / grid_size;
+	}
+
+	const int num_cells = num_cells_x * num_cells_y;
+	const int max_cells_per_element = Math::Max(1, int(MaxCellCoverage * float(num_cells)));
+
+	// Counts the elements in each cell first, then fill in the cells in descending stacking order.
+	cell_offsets.assign(num_cells + 1, 0);
+
+	auto GetCellRange = [this](const Bounds& element_bounds, int& x0, int& y0, int& x1, int& y1) {
+		const Vector2f cell_min = (element_bounds.min - origin) * inv_cell_size;
+		const Vector2f cell_max = (element_bounds.max - origin) * inv_cell_size;
+		x0 = Math::Clamp(int(cell_min.x), 0, num_cells_x - 1);
+		y0 = Math::Clamp(int(cell_min.y), 0, num_cells_y - 1);
+		x1 = Math::Clamp(int(cell_max.x), 0, num_cells_x - 1);
+		y1 = Math::Clamp(int(cell_max.y), 0, num_cells_y - 1);
+		return (x1 - x0 + 1) * (y1 - y0 + 1);
+	};
+
+	for (int i = num_elements - 1; i >= 0; i--)
+	{
+		Bounds& element_bounds = bounds[i];
+		int x0, y0, x1, y1;
+
+		if (!element_bounds.bounded || GetCellRange(element_bounds, x0, y0, x1, y1) > max_cells_per_element)
+		{
+			global_items.push_back(i);
+			continue;
+		}
+
+		for (int y = y0; y <= y1; y++)
+			for (int x = x0; x <= x1; x++)
+				cell_offsets[y * num_cells_x + x + 1] += 1;
+	}
+
+	for (int cell = 0; cell < num_cells; cell++)
+		cell_offsets[cell + 1] += cell_offsets[cell];
+
+	cell_items.resize(cell_offsets[num_cells]);
+	Vector<int> cell_fill(cell_offsets.begin(), cell_offsets.end() - 1);
+
+	for (int i = num_elements - 1; i >= 0; i--)
+	{
+		Bounds& element_bounds = bounds[i];
+		int x0, y0, x1, y1;
+
+		if (!element_bounds.bounded || GetCellRange(element_bounds, x0, y0, x1, y1) > max_cells_per_element)
+			continue;
+
+		for (int y = y0; y <= y1; y++)
+			for (int x = x0; x <= x1; x++)
+				cell_items[cell_fill[y * num_cells_x + x]++] = i;
+	}
+}
+
+bool HitTestGrid::Contains(int index, Vector2f point) const
+{
+	const Bounds& element_bounds = bounds[index];
+	if (!element_bounds.bounded)
+		return true;
+
+	return point.x >= element_bounds.min.x && point.y >= element_bounds.min.y && point.x <= element_bounds.max.x &&
+		point.y <= element_bounds.max.y;
+}
+
+} // namespace Rml
@@ -0,0 +1,134 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_HITTESTGRID_H
+#define RMLUI_CORE_HITTESTGRID_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	A uniform grid over the border boxes of the elements in a stacking context, used to find the elements which may
+	be located under a point without testing every element of the stacking context.
+
+	Candidates are identified by their index in the stacking context. Elements with a transform, and elements
+	establishing their own stacking context whose descendants may extend outside their boxes, have no known bounds and
+	are candidates for every point. The grid is built from the stacking context as a whole, and must be rebuilt once
+	the stacking context or any of its elements' boxes or offsets change.
+ */
+
+class HitTestGrid {
+public:
+	/// Stacking contexts with fewer elements than this are cheaper to test linearly.
+	static constexpr int MinNumElements = 16;
+
+	/// Rebuilds the grid from the elements of a stacking context, tagged with the given generation.
+	void Build(const ElementList& stacking_context, unsigned int generation);
+
+	/// Returns true if the grid was last built with the given generation.
+	bool IsBuilt(unsigned int generation) const { return built && generation == built_generation; }
+
+	/// Visits the candidates located under the given point, from the top-most to the bottom-most element in the
+	/// stacking context. Stops and returns the first non-null result of the visitor.
+	/// @param[in] point The point in window coordinates.
+	/// @param[in] visitor A function taking the index of a candidate in the stacking context, returning an element or nullptr.
+	template <typename Visitor>
+	Element* Find(Vector2f point, Visitor&& visitor) const;
+
+private:
+	struct Bounds {
+		Vector2f min;
+		Vector2f max;
+		bool bounded;
+	};
+
+	bool Contains(int index, Vector2f point) const;
+
+	bool built = false;
+	unsigned int built_generation = 0;
+
+	Vector<Bounds> bounds;
+
+	Vector2f origin;
+	Vector2f inv_cell_size;
+	int num_cells_x = 0;
+	int num_cells_y = 0;
+
+	// The candidates of each cell are stored contiguously in cell_items, from cell_offsets[cell] up to
+	// cell_offsets[cell + 1]. Both these and the global candidates are sorted from the top-most element.
+	Vector<int> cell_offsets;
+	Vector<int> cell_items;
+
+	// Candidates covering a large part of the grid, or without known bounds.
+	Vector<int> global_items;
+};
+
+template <typename Visitor>
+Element* HitTestGrid::Find(Vector2f point, Visitor&& visitor) const
+{
+	const int* it_cell = nullptr;
+	const int* end_cell = nullptr;
+
+	const Vector2f grid_point = (point - origin) * inv_cell_size;
+	if (grid_point.x >= 0.f && grid_point.y >= 0.f && grid_point.x <= float(num_cells_x) && grid_point.y <= float(num_cells_y))
+	{
+		// Points on the far edges of the grid belong to the last cells.
+		const int cell_x = (int(grid_point.x) < num_cells_x ? int(grid_point.x) : num_cells_x - 1);
+		const int cell_y = (int(grid_point.y) < num_cells_y ? int(grid_point.y) : num_cells_y - 1);
+		const int cell = cell_y * num_cells_x + cell_x;
+		it_cell = cell_items.data() + cell_offsets[cell];
+		end_cell = cell_items.data() + cell_offsets[cell + 1];
+	}
+
+	const int* it_global = global_items.data();
+	const int* end_global = global_items.data() + global_items.size();
+
+	// Merge the candidates of the cell and the global candidates, both are sorted in descending stacking order.
+	while (it_cell != end_cell || it_global != end_global)
+	{
+		int index;
+		if (it_global == end_global || (it_cell != end_cell && *it_cell > *it_global))
+			index = *it_cell++;
+		else
+			index = *it_global++;
+
+		if (!Contains(index, point))
+			continue;
+
+		if (Element* result = visitor(index))
+			return result;
+	}
+
+	return nullptr;
+}
+
+} // namespace Rml
+#endif
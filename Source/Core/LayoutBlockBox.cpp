@@ -100,7 +100,7 @@ LayoutBlockBox::LayoutBlockBox(LayoutBlockBox* _parent, Element* _element, const
 	if (element)
 	{
 		const auto& computed = element->GetComputedValues();
-		wrap_content = computed.white_space != Style::WhiteSpace::Nowrap;
+		wrap_content = computed.inherited->white_space != Style::WhiteSpace::Nowrap;
 
 		// Determine if this element should have scrollbars or not, and create them if so.
 		overflow_x_property = computed.overflow_x;
@@ -0,0 +1,121 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_LAYOUTCACHE_H
+#define RMLUI_CORE_LAYOUTCACHE_H
+
+#include "../../Include/RmlUi/Core/Box.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/*
+	Stores the results of intrinsic size measurements of an element, so that repeated queries made by flexbox and table
+	formatting do not need to format the element's subtree again. Each element owns a cache, which is cleared whenever the
+	layout of the element or any of its descendants is dirtied.
+*/
+class LayoutCache {
+public:
+	// Returns true and sets the width if a shrink-to-fit width was previously stored for the given containing block.
+	bool GetShrinkToFitWidth(Vector2f containing_block, float& out_width) const
+	{
+		for (const ShrinkToFitEntry& entry : shrink_to_fit_entries)
+		{
+			if (entry.valid && entry.containing_block == containing_block)
+			{
+				out_width = entry.width;
+				return true;
+			}
+		}
+		return false;
+	}
+	void SetShrinkToFitWidth(Vector2f containing_block, float width)
+	{
+		ShrinkToFitEntry& entry = shrink_to_fit_entries[next_shrink_to_fit_entry];
+		next_shrink_to_fit_entry = (next_shrink_to_fit_entry + 1) % NumEntries;
+		entry.valid = true;
+		entry.containing_block = containing_block;
+		entry.width = width;
+	}
+
+	// Returns true and sets the size if the element was previously formatted with the given containing block and initial box.
+	bool GetFormattedSize(Vector2f containing_block, const Box& initial_box, Vector2f& out_size) const
+	{
+		for (const FormattedSizeEntry& entry : formatted_size_entries)
+		{
+			if (entry.valid && entry.containing_block == containing_block && entry.initial_box == initial_box)
+			{
+				out_size = entry.size;
+				return true;
+			}
+		}
+		return false;
+	}
+	void SetFormattedSize(Vector2f containing_block, const Box& initial_box, Vector2f size)
+	{
+		FormattedSizeEntry& entry = formatted_size_entries[next_formatted_size_entry];
+		next_formatted_size_entry = (next_formatted_size_entry + 1) % NumEntries;
+		entry.valid = true;
+		entry.containing_block = containing_block;
+		entry.initial_box = initial_box;
+		entry.size = size;
+	}
+
+	// Returns true if there is nothing stored in the cache.
+	bool IsEmpty() const { return !shrink_to_fit_entries[0].valid && !formatted_size_entries[0].valid; }
+
+	void Clear()
+	{
+		if (!IsEmpty())
+			*this = LayoutCache();
+	}
+
+private:
+	// Flex items and table cells are typically measured against one or two different constraints per layout pass.
+	static constexpr int NumEntries = 2;
+
+	struct ShrinkToFitEntry {
+		bool valid = false;
+		Vector2f containing_block;
+		float width = 0.f;
+	};
+	struct FormattedSizeEntry {
+		bool valid = false;
+		Vector2f containing_block;
+		Box initial_box;
+		Vector2f size;
+	};
+
+	ShrinkToFitEntry shrink_to_fit_entries[NumEntries];
+	FormattedSizeEntry formatted_size_entries[NumEntries];
+	int next_shrink_to_fit_entry = 0;
+	int next_formatted_size_entry = 0;
+};
+
+} // namespace Rml
+#endif
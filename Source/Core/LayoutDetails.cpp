@@ -27,6 +27,7 @@
  */
 
 #include "LayoutDetails.h"
+#include "LayoutCache.h"
 #include "LayoutEngine.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementScroll.h"
@@ -240,6 +241,13 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 {
 	RMLUI_ASSERT(element);
 
+	// The width only depends on the element's subtree and the containing block, thus we can reuse any previous measurement as
+	// long as the layout of the subtree has not been dirtied since.
+	LayoutCache& layout_cache = element->GetLayoutCache();
+	float cached_width = 0.f;
+	if (layout_cache.GetShrinkToFitWidth(containing_block, cached_width))
+		return cached_width;
+
 	Box box;
 	float min_height, max_height;
 	LayoutDetails::BuildBox(box, containing_block, element, BoxContext::Block, containing_block.x);
@@ -254,7 +262,8 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 	LayoutBlockBox* block_context_box = containing_block_box.AddBlockElement(element, box, min_height, max_height);
 
 	// @performance. Some formatting can be simplified, eg. absolute elements do not contribute to the shrink-to-fit width.
-	// Also, children of elements with a fixed width and height don't need to be formatted further.
+	// Also, children of elements with a fixed width and height don't need to be formatted further. Results are cached,
+	// see above.
 	for (int i = 0; i < element->GetNumChildren(); i++)
 	{
 		if (!LayoutEngine::FormatElement(block_context_box, element->GetChild(i)))
@@ -265,7 +274,10 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 	// away with not closing the boxes. This is avoided for performance reasons.
 	//block_context_box->Close();
 
-	return Math::Min(containing_block.x, block_context_box->GetShrinkToFitWidth());
+	const float width = Math::Min(containing_block.x, block_context_box->GetShrinkToFitWidth());
+	layout_cache.SetShrinkToFitWidth(containing_block, width);
+
+	return width;
 }
 
 ComputedAxisSize LayoutDetails::BuildComputedHorizontalSize(const ComputedValues& computed)
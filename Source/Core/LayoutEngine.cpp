@@ -28,12 +28,14 @@
 
 #include "LayoutEngine.h"
 #include "LayoutBlockBoxSpace.h"
+#include "LayoutCache.h"
 #include "LayoutDetails.h"
 #include "LayoutFlex.h"
 #include "LayoutInlineBoxText.h"
 #include "LayoutTable.h"
 #include "Pool.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include <cstddef>
@@ -52,9 +54,10 @@ static constexpr std::size_t ChunkSizeBig = sizeof(LayoutBlockBox);
 static constexpr std::size_t ChunkSizeMedium = MAX(sizeof(LayoutInlineBox), sizeof(LayoutInlineBoxText));
 static constexpr std::size_t ChunkSizeSmall = MAX(sizeof(LayoutLineBox), sizeof(LayoutBlockBoxSpace));
 
-static Pool< LayoutChunk<ChunkSizeBig> > layout_chunk_pool_big(50, true);
-static Pool< LayoutChunk<ChunkSizeMedium> > layout_chunk_pool_medium(50, true);
-static Pool< LayoutChunk<ChunkSizeSmall> > layout_chunk_pool_small(50, true);
+// Layout boxes never outlive the formatting of their document, and documents may be formatted in parallel.
+static thread_local Pool< LayoutChunk<ChunkSizeBig> > layout_chunk_pool_big(50, true);
+static thread_local Pool< LayoutChunk<ChunkSizeMedium> > layout_chunk_pool_medium(50, true);
+static thread_local Pool< LayoutChunk<ChunkSizeSmall> > layout_chunk_pool_small(50, true);
 
 
 // Formats the contents for a root-level element (usually a document or floating element).
@@ -100,6 +103,89 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, co
 	element->OnLayout();
 }
 
+Vector2f LayoutEngine::GetFormattedContentSize(Element* element, Vector2f containing_block, const Box& initial_box)
+{
+	LayoutCache& layout_cache = element->GetLayoutCache();
+
+	Vector2f content_size;
+	if (layout_cache.GetFormattedSize(containing_block, initial_box, content_size))
+		return content_size;
+
+	FormatElement(element, containing_block, &initial_box);
+	content_size = element->GetBox().GetSize();
+
+	layout_cache.SetFormattedSize(containing_block, initial_box, content_size);
+
+	return content_size;
+}
+
+bool LayoutEngine::IsLayoutBoundary(Element* element)
+{
+	Element* parent = element->GetParentNode();
+	if (!parent || element->GetDisplay() != Style::Display::Block)
+		return false;
+
+	const ComputedValues& computed = element->GetComputedValues();
+
+	// Absolutely positioned elements are formatted on their own against the padding box of their offset parent, and are
+	// then placed at their static position. Neither depends on their contents.
+	if (computed.position == Style::Position::Absolute || computed.position == Style::Position::Fixed)
+		return element->offset_parent != nullptr;
+
+	// Other boxes need a size independent of their contents, and must not contribute their overflow to the ancestors. They
+	// must also be positioned so that they become the offset parent of their contents.
+	if (computed.position != Style::Position::Relative || computed.float_ != Style::Float::None)
+		return false;
+	if (computed.width.type == Style::Width::Auto || computed.height.type == Style::Height::Auto)
+		return false;
+	if (computed.overflow_x == Style::Overflow::Visible || computed.overflow_y == Style::Overflow::Visible)
+		return false;
+
+	// Documents are always formatted as block containers.
+	if (parent == element->GetOwnerDocument())
+		return true;
+
+	switch (parent->GetDisplay())
+	{
+	case Style::Display::Block:
+	case Style::Display::InlineBlock:
+	case Style::Display::Flex:
+	case Style::Display::TableCell:
+		return true;
+	default:
+		break;
+	}
+
+	return false;
+}
+
+void LayoutEngine::FormatLayoutBoundary(Element* element)
+{
+	RMLUI_ASSERT(IsLayoutBoundary(element));
+#ifdef RMLUI_ENABLE_PROFILING
+	RMLUI_ZoneScopedC(0xB22222);
+	auto name = CreateString(80, "Boundary %s %x", element->GetAddress(false, false).c_str(), element);
+	RMLUI_ZoneName(name.c_str(), name.size());
+#endif
+
+	const Style::Position position = element->GetComputedValues().position;
+
+	if (position == Style::Position::Absolute || position == Style::Position::Fixed)
+	{
+		Element* offset_parent = element->offset_parent;
+		FormatElement(element, offset_parent->GetBox().GetSize(Box::PADDING));
+
+		// The base offset is unchanged, but any offset from the right or bottom edges depends on the new size of the element.
+		element->SetOffset(element->relative_offset_base, offset_parent, element->offset_fixed);
+	}
+	else
+	{
+		// The box of the element is kept as is, while its contents are formatted again.
+		const Box box = element->GetBox();
+		FormatElement(element, element->GetParentNode()->GetBox().GetSize(), &box);
+	}
+}
+
 void* LayoutEngine::AllocateLayoutChunk(size_t size)
 {
 	static_assert(ChunkSizeBig > ChunkSizeMedium && ChunkSizeMedium > ChunkSizeSmall, "The following assumes a strict ordering of the chunk sizes.");
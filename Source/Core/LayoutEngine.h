@@ -51,6 +51,26 @@ public:
 	/// @param[out] visible_overflow_size Optionally output the overflow size of the element.
 	static void FormatElement(Element* element, Vector2f containing_block, const Box* override_initial_box = nullptr, Vector2f* out_visible_overflow_size = nullptr);
 
+	/// Measures the content size of a root-level element, as if formatted by FormatElement() with the given initial box. The
+	/// result is cached until the layout of the element's subtree is dirtied, in which case the element may not be formatted
+	/// at all. Thus, it must be formatted properly afterward if its layout is to be used.
+	/// @param[in] element The element to measure.
+	/// @param[in] containing_block The size of the containing block.
+	/// @param[in] initial_box The initial box of the element.
+	/// @return The resulting content size of the element's box.
+	static Vector2f GetFormattedContentSize(Element* element, Vector2f containing_block, const Box& initial_box);
+
+	/// Returns true if the layout of the element's contents can not affect the layout of anything outside the element. This
+	/// applies to absolutely positioned block elements, and to relatively positioned block elements with a definite width
+	/// and height whose overflow is not visible.
+	/// @param[in] element The element to test, must be part of a document.
+	static bool IsLayoutBoundary(Element* element);
+
+	/// Formats the contents of a layout boundary which has previously been formatted as part of its document, without
+	/// formatting any of its ancestors.
+	/// @param[in] element The layout boundary element.
+	static void FormatLayoutBoundary(Element* element);
+
 	/// Positions a single element and its children within a block formatting context.
 	/// @param[in] block_context_box The open block box to layout the element in.
 	/// @param[in] element The element to lay out.
@@ -178,12 +178,12 @@ void LayoutFlex::Format()
 	// For details, see https://drafts.csswg.org/css-flexbox/#layout-algorithm
 
 	const ComputedValues& computed_flex = element_flex->GetComputedValues();
-	const Style::FlexDirection direction = computed_flex.flex_direction;
+	const Style::FlexDirection direction = computed_flex.rare->flex_direction;
 
 	const bool main_axis_horizontal = (direction == Style::FlexDirection::Row || direction == Style::FlexDirection::RowReverse);
 	const bool direction_reverse = (direction == Style::FlexDirection::RowReverse || direction == Style::FlexDirection::ColumnReverse);
-	const bool flex_single_line = (computed_flex.flex_wrap == Style::FlexWrap::Nowrap);
-	const bool wrap_reverse = (computed_flex.flex_wrap == Style::FlexWrap::WrapReverse);
+	const bool flex_single_line = (computed_flex.rare->flex_wrap == Style::FlexWrap::Nowrap);
+	const bool wrap_reverse = (computed_flex.rare->flex_wrap == Style::FlexWrap::WrapReverse);
 
 	const float main_available_size = (main_axis_horizontal ? flex_available_content_size.x : flex_available_content_size.y);
 	const float cross_available_size = (!main_axis_horizontal ? flex_available_content_size.x : flex_available_content_size.y);
@@ -237,9 +237,9 @@ void LayoutFlex::Format()
 			item_main_size = computed_main_size.size;
 		}
 
-		item.flex_shrink_factor = computed.flex_shrink;
-		item.flex_grow_factor = computed.flex_grow;
-		item.align_self = computed.align_self;
+		item.flex_shrink_factor = computed.rare->flex_shrink;
+		item.flex_grow_factor = computed.rare->flex_grow;
+		item.align_self = computed.rare->align_self;
 
 		static_assert(int(Style::AlignSelf::FlexStart) == int(Style::AlignItems::FlexStart) + 1 &&
 				int(Style::AlignSelf::Stretch) == int(Style::AlignItems::Stretch) + 1,
@@ -247,14 +247,14 @@ void LayoutFlex::Format()
 
 		// Use the container's align-items property if align-self is auto.
 		if (item.align_self == Style::AlignSelf::Auto)
-			item.align_self = static_cast<Style::AlignSelf>(static_cast<int>(computed_flex.align_items) + 1);
+			item.align_self = static_cast<Style::AlignSelf>(static_cast<int>(computed_flex.rare->align_items) + 1);
 
 		const float sum_padding_border = item.main.sum_edges - (item.main.margin_a + item.main.margin_b);
 
 		// Find the flex base size (possibly negative when using border box sizing)
-		if (computed.flex_basis.type != Style::FlexBasis::Auto)
+		if (computed.rare->flex_basis.type != Style::FlexBasis::Auto)
 		{
-			item.inner_flex_base_size = ResolveValue(computed.flex_basis, main_size_base_value);
+			item.inner_flex_base_size = ResolveValue(computed.rare->flex_basis, main_size_base_value);
 			if (computed.box_sizing == Style::BoxSizing::BorderBox)
 				item.inner_flex_base_size -= sum_padding_border;
 		}
@@ -277,8 +277,7 @@ void LayoutFlex::Format()
 			if (initial_box_size.x < 0.f)
 				format_box.SetContent(Vector2f(flex_available_content_size.x - item.cross.sum_edges, initial_box_size.y));
 
-			LayoutEngine::FormatElement(element, flex_content_containing_block, &format_box);
-			item.inner_flex_base_size = element->GetBox().GetSize().y;
+			item.inner_flex_base_size = LayoutEngine::GetFormattedContentSize(element, flex_content_containing_block, format_box).y;
 		}
 
 		// Calculate the hypothetical main size (clamped flex base size).
@@ -494,7 +493,7 @@ void LayoutFlex::Format()
 				using Style::JustifyContent;
 				const int num_items = int(line.items.size());
 
-				switch (computed_flex.justify_content)
+				switch (computed_flex.rare->justify_content)
 				{
 				case JustifyContent::SpaceBetween:
 					if (num_items > 1)
@@ -563,8 +562,8 @@ void LayoutFlex::Format()
 				if (content_size.y < 0.0f)
 				{
 					item.box.SetContent(Vector2f(used_main_size_inner, content_size.y));
-					LayoutEngine::FormatElement(item.element, flex_content_containing_block, &item.box);
-					item.hypothetical_cross_size = item.element->GetBox().GetSize().y + item.cross.sum_edges;
+					item.hypothetical_cross_size =
+						LayoutEngine::GetFormattedContentSize(item.element, flex_content_containing_block, item.box).y + item.cross.sum_edges;
 				}
 				else
 				{
@@ -610,7 +609,7 @@ void LayoutFlex::Format()
 	}
 
 	// Stretch out the lines if we have extra space.
-	if (cross_available_size >= 0.f && computed_flex.align_content == Style::AlignContent::Stretch)
+	if (cross_available_size >= 0.f && computed_flex.rare->align_content == Style::AlignContent::Stretch)
 	{
 		int remaining_space = static_cast<int>(cross_available_size -
 			std::accumulate(container.lines.begin(), container.lines.end(), 0.f,
@@ -757,7 +756,7 @@ void LayoutFlex::Format()
 		{
 			using Style::AlignContent;
 
-			switch (computed_flex.align_content)
+			switch (computed_flex.rare->align_content)
 			{
 			case AlignContent::SpaceBetween:
 				if (num_lines > 1)
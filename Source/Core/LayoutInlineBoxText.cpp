@@ -179,7 +179,7 @@ void LayoutInlineBoxText::BuildWordBox()
 
 		const ComputedValues& computed = text_element->GetComputedValues();
 		const String font_family_property = text_element->GetProperty<String>("font-family");
-		const String& font_family_computed = computed.font_family;
+		const String& font_family_computed = computed.inherited->font_family;
 
 		if (ComputeFontFamily(font_family_property) != font_family_computed)
 		{
@@ -202,7 +202,7 @@ void LayoutInlineBoxText::BuildWordBox()
 		}
 		else
 		{
-			const String font_face_description = FontFaceDescription(font_family_property, computed.font_style, computed.font_weight);
+			const String font_face_description = FontFaceDescription(font_family_property, computed.inherited->font_style, computed.inherited->font_weight);
 
 			Log::Message(
 				Log::LT_WARNING,
@@ -138,7 +138,7 @@ LayoutInlineBox* LayoutLineBox::Close(UniquePtr<LayoutInlineBox> overflow)
 
 	// Position all the boxes horizontally in the line. We only need to reposition the elements if they're set to
 	// centre or right; the element are already placed left-aligned, and justification occurs at the text level.
-	Style::TextAlign text_align_property = parent->GetParent()->GetElement()->GetComputedValues().text_align;
+	Style::TextAlign text_align_property = parent->GetParent()->GetElement()->GetComputedValues().inherited->text_align;
 	if (text_align_property == Style::TextAlign::Center ||
 		text_align_property == Style::TextAlign::Right)
 	{
@@ -64,8 +64,8 @@ Vector2f LayoutTable::FormatTable(Box& box, Vector2f min_size, Vector2f max_size
 		min_size.y = Math::Max(min_size.y, table_initial_content_size.y);
 
 	const Vector2f table_gap = Vector2f(
-		ResolveValue(computed_table.column_gap, table_initial_content_size.x), 
-		ResolveValue(computed_table.row_gap, table_initial_content_size.y)
+		ResolveValue(computed_table.rare->column_gap, table_initial_content_size.x), 
+		ResolveValue(computed_table.rare->row_gap, table_initial_content_size.y)
 	);
 
 	TableGrid grid;
@@ -277,8 +277,7 @@ void LayoutTable::DetermineRowHeights()
 				// If both the row and the cell heights are 'auto', we need to format the cell to get its height.
 				if (box.GetSize().y < 0)
 				{
-					LayoutEngine::FormatElement(element_cell, table_initial_content_size, &box);
-					box.SetContent(element_cell->GetBox().GetSize());
+					box.SetContent(LayoutEngine::GetFormattedContentSize(element_cell, table_initial_content_size, box));
 				}
 
 				// Find the height of the cell which applies only to this row. 
@@ -402,8 +401,7 @@ void LayoutTable::FormatCells()
 			if (is_aligned)
 			{
 				// We need to format the cell to know how much padding to add.
-				LayoutEngine::FormatElement(element_cell, table_initial_content_size, &box);
-				box.SetContent(element_cell->GetBox().GetSize());
+				box.SetContent(LayoutEngine::GetFormattedContentSize(element_cell, table_initial_content_size, box));
 			}
 			else
 			{
@@ -31,6 +31,7 @@
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 
+#include <mutex>
 #include <stdarg.h>
 #ifdef RMLUI_PLATFORM_WIN32
 #include <windows.h>
@@ -38,6 +39,9 @@
 
 namespace Rml {
 
+// Serialises messages, which may be logged from worker threads while documents are updated in parallel.
+static std::recursive_mutex log_mutex;
+
 // Initialises the logging interface.
 bool Log::Initialise()
 {
@@ -66,6 +70,7 @@ void Log::Message(Log::Type type, const char* fmt, ...)
 	buffer[len] = '\0';
 	va_end(argument_list);
 
+	std::lock_guard<std::recursive_mutex> lock(log_mutex);
 	GetSystemInterface()->LogMessage(type, buffer);
 }
 
@@ -95,6 +100,7 @@ void Log::ParseError(const String& filename, int line_number, const char* fmt, .
 bool Assert(const char* msg, const char* file, int line)
 {
 	String message = CreateString(1024, "%s\n%s:%d", msg, file, line);
+	std::lock_guard<std::recursive_mutex> lock(log_mutex);
 	return GetSystemInterface()->LogMessage(Log::LT_ASSERT, message);
 }
 
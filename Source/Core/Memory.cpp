@@ -30,6 +30,7 @@
 #include <memory>
 #include <stdlib.h>
 #include <stdint.h>
+#include <algorithm>
 
 namespace Rml {
 
@@ -88,10 +89,97 @@ void BasicStackAllocator::deallocate(void* obj) noexcept
 
 BasicStackAllocator& GetGlobalBasicStackAllocator()
 {
-	static BasicStackAllocator stack_allocator(10 * 1024);
+	// Thread-local, since the allocator may also be used by tasks running on the worker pool.
+	static thread_local BasicStackAllocator stack_allocator(10 * 1024);
 	return stack_allocator;
 }
 
 }
 
+static thread_local FrameArena* active_frame_arena = nullptr;
+
+FrameArena::FrameArena(size_t initial_size)
+{
+	AddBlock(initial_size);
+}
+
+FrameArena::~FrameArena() noexcept
+{
+	RMLUI_ASSERTMSG(num_live_allocations == 0, "Frame arena destroyed while some of its allocations are still in use.");
+	for (Block& block : blocks)
+		free(block.data);
+}
+
+void* FrameArena::Allocate(size_t alignment, size_t byte_size)
+{
+	void* ptr = p;
+	size_t available_space = size_t(end - p);
+
+	if (!Detail::rmlui_align(alignment, byte_size, ptr, available_space))
+	{
+		// Out of space, continue in a new block at least twice the size of the previous one.
+		AddBlock(std::max(blocks.back().size * 2, byte_size + alignment));
+		ptr = p;
+		available_space = size_t(end - p);
+		Detail::rmlui_align(alignment, byte_size, ptr, available_space);
+	}
+
+	p = (byte*)ptr + byte_size;
+	num_live_allocations += 1;
+	return ptr;
+}
+
+void FrameArena::Deallocate(void* /*ptr*/) noexcept
+{
+	RMLUI_ASSERT(num_live_allocations > 0);
+	num_live_allocations -= 1;
+}
+
+void FrameArena::Reset()
+{
+	if (num_live_allocations > 0)
+		return;
+
+	if (blocks.size() > 1)
+	{
+		// Replace the blocks by a single one large enough to hold everything from this frame.
+		size_t total_size = 0;
+		for (Block& block : blocks)
+		{
+			total_size += block.size;
+			free(block.data);
+		}
+		blocks.clear();
+		AddBlock(total_size);
+	}
+
+	p = blocks.front().data;
+	end = p + blocks.front().size;
+}
+
+FrameArena* FrameArena::GetActive()
+{
+	return active_frame_arena;
+}
+
+void FrameArena::AddBlock(size_t min_size)
+{
+	Block block = {(byte*)malloc(min_size), min_size};
+	blocks.push_back(block);
+	p = block.data;
+	end = block.data + block.size;
+}
+
+FrameArenaScope::FrameArenaScope(FrameArena* arena) : arena(arena), previous_arena(active_frame_arena)
+{
+	active_frame_arena = arena;
+}
+
+FrameArenaScope::~FrameArenaScope() noexcept
+{
+	active_frame_arena = previous_arena;
+	if (arena && arena != previous_arena)
+		arena->Reset();
+}
+
 } // namespace Rml
@@ -32,6 +32,7 @@
 
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Traits.h"
+#include <memory>
 
 namespace Rml {
 
@@ -106,6 +107,108 @@ bool operator!=(const GlobalStackAllocator<T>&, const GlobalStackAllocator<U>&)
 
 
 
+/**
+	Frame arena.
+
+	A chunked bump allocator for short-lived allocations made during a single update or render call of a context.
+	Allocation only moves a pointer, deallocation merely records that the memory is no longer in use. Once every
+	allocation has been released, the arena can be reset and its memory is re-used by the next frame. After a reset,
+	any overflow blocks are merged into a single block so that a steady workload eventually allocates nothing.
+
+	The arena is not thread-safe, it is made active on the calling thread by a FrameArenaScope.
+*/
+class FrameArena : NonCopyMoveable {
+public:
+	FrameArena(size_t initial_size = 16 * 1024);
+	~FrameArena() noexcept;
+
+	void* Allocate(size_t alignment, size_t byte_size);
+	void Deallocate(void* ptr) noexcept;
+
+	/// Rewinds the arena, ignored while any allocations are still in use.
+	void Reset();
+
+	/// Returns the arena active on the current thread, or nullptr if none.
+	static FrameArena* GetActive();
+
+private:
+	friend class FrameArenaScope;
+
+	struct Block {
+		byte* data;
+		size_t size;
+	};
+
+	void AddBlock(size_t min_size);
+
+	Vector<Block> blocks;
+	byte* p = nullptr;
+	byte* end = nullptr;
+	size_t num_live_allocations = 0;
+};
+
+/**
+	Makes a frame arena active on the current thread for the lifetime of the scope. The arena is reset when its
+	outermost scope ends.
+*/
+class FrameArenaScope : NonCopyMoveable {
+public:
+	FrameArenaScope(FrameArena* arena);
+	~FrameArenaScope() noexcept;
+
+private:
+	FrameArena* arena;
+	FrameArena* previous_arena;
+};
+
+/**
+	Frame allocator.
+
+	Allocates from the frame arena active at the time of construction. Falls back to the heap when there is no active
+	arena, such as on the worker pool's threads. Containers using this allocator must not outlive the scope of the arena.
+*/
+template <typename T>
+class FrameAllocator
+{
+public:
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	FrameAllocator() noexcept : arena(FrameArena::GetActive()) {}
+	template <class U> FrameAllocator(const FrameAllocator<U>& other) noexcept : arena(other.arena) {}
+
+	T* allocate(size_t num_objects) {
+		if (arena)
+			return reinterpret_cast<T*>(arena->Allocate(alignof(T), num_objects * sizeof(T)));
+		return std::allocator<T>().allocate(num_objects);
+	}
+
+	void deallocate(T* ptr, size_t num_objects) noexcept {
+		if (arena)
+			arena->Deallocate(ptr);
+		else
+			std::allocator<T>().deallocate(ptr, num_objects);
+	}
+
+private:
+	template <typename U> friend class FrameAllocator;
+	template <class T1, class U1> friend bool operator==(const FrameAllocator<T1>&, const FrameAllocator<U1>&);
+
+	FrameArena* arena;
+};
+
+template <class T, class U>
+bool operator==(const FrameAllocator<T>& a, const FrameAllocator<U>& b) { return a.arena == b.arena; }
+template <class T, class U>
+bool operator!=(const FrameAllocator<T>& a, const FrameAllocator<U>& b) { return !(a == b); }
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+
+
 /**
 	A poor man's dynamic array.
 
@@ -28,12 +28,20 @@
 
 #include "../../Include/RmlUi/Core/ObserverPtr.h"
 #include "Pool.h"
+#include <mutex>
 
 namespace Rml {
 
 // The ObserverPtrBlock pool
 Pool<ObserverPtrBlock>* observerPtrBlockPool = nullptr;
 
+// Blocks may be allocated and released on worker threads while documents are updated in parallel. Leaked along with the pool.
+static std::mutex& GetPoolMutex()
+{
+	static std::mutex* pool_mutex = new std::mutex;
+	return *pool_mutex;
+}
+
 static Pool<ObserverPtrBlock>& GetPool()
 {
 	// Wrap pool in a function to ensure it is initialized before use.
@@ -50,12 +58,14 @@ void DeallocateObserverPtrBlockIfEmpty(ObserverPtrBlock* block)
 	RMLUI_ASSERT(block->num_observers >= 0);
 	if (block->num_observers == 0 && block->pointed_to_object == nullptr)
 	{
+		std::lock_guard<std::mutex> lock(GetPoolMutex());
 		GetPool().DestroyAndDeallocate(block);
 	}
 }
 
 ObserverPtrBlock* AllocateObserverPtrBlock()
 {
+	std::lock_guard<std::mutex> lock(GetPoolMutex());
 	return GetPool().AllocateAndConstruct();
 }
 
@@ -107,6 +107,11 @@ const PropertyDefinition* PropertySpecification::GetProperty(const String& prope
 	return GetProperty(property_map->GetId(property_name));
 }
 
+const String& PropertySpecification::GetPropertyName(PropertyId id) const
+{
+	return property_map->GetName(id);
+}
+
 // Fetches a list of the names of all registered property definitions.
 const PropertyIdSet& PropertySpecification::GetRegisteredProperties(void) const
 {
@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../Include/RmlUi/Core/DrawList.h"
 #include "TextureDatabase.h"
 
 namespace Rml {
@@ -62,6 +63,55 @@ void RenderInterface::ReleaseCompiledGeometry(CompiledGeometryHandle /*geometry*
 {
 }
 
+// Called by RmlUi when it wants to render a recorded draw list.
+void RenderInterface::RenderDrawList(const DrawList& draw_list)
+{
+	bool scissor_enabled = false;
+	Vector2i scissor_origin;
+	Vector2i scissor_dimensions;
+	int transform_index = -1;
+
+	// The render state is unknown at this point, make sure it is submitted before the first command.
+	bool first_command = true;
+
+	for (const DrawCommand& command : draw_list.commands)
+	{
+		if (first_command || command.transform_index != transform_index)
+		{
+			transform_index = command.transform_index;
+			SetTransform(transform_index >= 0 ? &draw_list.transforms[transform_index] : nullptr);
+		}
+
+		bool set_scissor_region = false;
+		if (first_command || command.scissor_enabled != scissor_enabled)
+		{
+			scissor_enabled = command.scissor_enabled;
+			EnableScissorRegion(scissor_enabled);
+			set_scissor_region = scissor_enabled;
+		}
+
+		if (scissor_enabled && (set_scissor_region || command.scissor_origin != scissor_origin || command.scissor_dimensions != scissor_dimensions))
+		{
+			scissor_origin = command.scissor_origin;
+			scissor_dimensions = command.scissor_dimensions;
+			SetScissorRegion(scissor_origin.x, scissor_origin.y, scissor_dimensions.x, scissor_dimensions.y);
+		}
+
+		first_command = false;
+
+		// The legacy geometry interface takes mutable pointers, although the data is never written to.
+		Vertex* vertices = const_cast<Vertex*>(&draw_list.vertices[command.vertex_offset]);
+		int* indices = const_cast<int*>(&draw_list.indices[command.index_offset]);
+		RenderGeometry(vertices, command.num_vertices, indices, command.num_indices, command.texture, Vector2f(0, 0));
+	}
+
+	// Leave the render interface in an untransformed and unclipped state.
+	if (transform_index >= 0)
+		SetTransform(nullptr);
+	if (scissor_enabled)
+		EnableScissorRegion(false);
+}
+
 // Called by RmlUi when a texture is required by the library.
 bool RenderInterface::LoadTexture(TextureHandle& /*texture_handle*/, Vector2i& /*texture_dimensions*/, const String& /*source*/)
 {
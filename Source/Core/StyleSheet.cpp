@@ -36,9 +36,13 @@
 #include "ElementStyle.h"
 #include "StyleSheetNode.h"
 #include <algorithm>
+#include <mutex>
 
 namespace Rml {
 
+// Protects the element definition caches of all style sheets, as documents sharing a style sheet may be updated in parallel.
+static std::mutex node_cache_mutex;
+
 StyleSheet::StyleSheet()
 {
 	root = MakeUnique<StyleSheetNode>();
@@ -170,23 +174,29 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	RMLUI_ASSERT_NONRECURSIVE;
 
 	// Using static to avoid allocations. Make sure we don't call this function recursively.
-	static Vector< const StyleSheetNode* > applicable_nodes;
+	static thread_local Vector< const StyleSheetNode* > applicable_nodes;
 	applicable_nodes.clear();
 
-	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
+	// When available, the ancestor filter lets us quickly reject nodes requiring ancestors which are not in the element's hierarchy.
+	const AncestorFilter* ancestor_filter = AncestorFilter::GetFilterForElement(element);
+
+	auto AddApplicableNode = [element, ancestor_filter](const StyleSheetNode* node) {
+		if (ancestor_filter && !node->MayMatchAncestors(*ancestor_filter))
+			return;
+
+		// Now see if we satisfy the requirements of the node, including all ancestor nodes. What this involves is traversing the style
+		// nodes backwards, trying to match nodes in the element's hierarchy to nodes in the style hierarchy.
+		if (node->IsApplicable(element))
+			applicable_nodes.push_back(node);
+	};
+
+	auto AddApplicableNodes = [&AddApplicableNode](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
 		auto it_nodes = node_index.find(Hash<String>()(key));
 		if (it_nodes != node_index.end())
 		{
-			const StyleSheetIndex::NodeList& nodes = it_nodes->second;
-
-			for (const StyleSheetNode* node : nodes)
-			{
-				// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
-				// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
-				// element's hierarchy to nodes in the style hierarchy.
-				if (node->IsApplicable(element))
-					applicable_nodes.push_back(node);
-			}
+			// We found nodes that have at least one requirement matching the element.
+			for (const StyleSheetNode* node : it_nodes->second)
+				AddApplicableNode(node);
 		}
 	};
 
@@ -204,13 +214,16 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 
 	AddApplicableNodes(styled_node_index.tags, tag);
 
-	// Also check all remaining nodes that don't contain any indexed requirements.
-	for (const StyleSheetNode* node : styled_node_index.other)
+	if (!styled_node_index.pseudo_classes.empty())
 	{
-		if (node->IsApplicable(element))
-			applicable_nodes.push_back(node);
+		for (const auto& pseudo_class : element->GetStyle()->GetActivePseudoClasses())
+			AddApplicableNodes(styled_node_index.pseudo_classes, pseudo_class.first);
 	}
 
+	// Also check all remaining nodes that don't contain any indexed requirements.
+	for (const StyleSheetNode* node : styled_node_index.other)
+		AddApplicableNode(node);
+
 	// If this element definition won't actually store any information, don't bother with it.
 	if (applicable_nodes.empty())
 		return nullptr;
@@ -225,6 +238,7 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 	});
 
 	// Check if this puppy has already been cached in the node index.
+	std::lock_guard<std::mutex> lock(node_cache_mutex);
 	SharedPtr<const ElementDefinition>& definition = node_cache[applicable_nodes];
 	if (!definition)
 	{
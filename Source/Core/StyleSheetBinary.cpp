@@ -0,0 +1,881 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "StyleSheetBinary.h"
+#include "BinaryFormat.h"
+#include "StyleSheetFactory.h"
+#include "StyleSheetNode.h"
+#include "../../Include/RmlUi/Core/DecoratorInstancer.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/ID.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/PropertyDefinition.h"
+#include "../../Include/RmlUi/Core/PropertySpecification.h"
+#include "../../Include/RmlUi/Core/Stream.h"
+#include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "../../Include/RmlUi/Core/Transform.h"
+#include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+namespace Rml {
+
+// The signature at the start of every binary style sheet.
+static const char binary_signature[BinaryWriter::signature_size] = { 'R', 'C', 'S', 'S', 'B', 'I', 'N', '\0' };
+
+// Must be bumped whenever the layout of the format or any of the serialized types change. The library version is stored as
+// well, as the serialized types may change between versions of the library without the format being bumped.
+static constexpr uint32_t binary_version = 2;
+
+// Transform primitives are stored as their raw bytes.
+static_assert(std::is_trivially_copyable<TransformPrimitive>::value, "Transform primitives must be trivially copyable to be stored in binary style sheets.");
+static_assert(std::is_standard_layout<TransformPrimitive>::value, "The type of stored transform primitives must be located by its offset.");
+
+// Returns true if the raw bytes of a stored transform primitive hold a known primitive type.
+static bool IsValidTransformPrimitive(const TransformPrimitive& primitive)
+{
+	// The type is inspected through its bytes, as loading an enumerator outside the valid range is undefined.
+	using TypeInteger = std::underlying_type<TransformPrimitive::Type>::type;
+	TypeInteger type = 0;
+	memcpy(&type, reinterpret_cast<const char*>(&primitive) + offsetof(TransformPrimitive, type), sizeof(type));
+	return (uint64_t)type <= (uint64_t)TransformPrimitive::DECOMPOSEDMATRIX4;
+}
+
+// Returns true if the unit is a single known unit, as held by any parsed property.
+static bool IsValidUnit(const int32_t unit)
+{
+	return unit > 0 && unit <= (int32_t)Property::RATIO && (unit & (unit - 1)) == 0;
+}
+
+// Tweens are stored by their in and out types.
+static bool FindTweenTypes(const Tween& tween, uint8_t& type_in, uint8_t& type_out)
+{
+	for (int i = 0; i < (int)Tween::Callback; i++)
+	{
+		for (int j = 0; j < (int)Tween::Callback; j++)
+		{
+			if (Tween((Tween::Type)i, (Tween::Type)j) == tween)
+			{
+				type_in = (uint8_t)i;
+				type_out = (uint8_t)j;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+class StyleSheetBinary::Writer : public BinaryWriter {
+public:
+	bool WriteMediaBlocks(const MediaBlockList& media_blocks)
+	{
+		Write((uint32_t)media_blocks.size());
+		for (const MediaBlock& media_block : media_blocks)
+		{
+			WriteProperties(media_block.properties, nullptr);
+			WriteStyleSheet(*media_block.stylesheet);
+		}
+		return valid;
+	}
+
+	// Assembles the header and the string and source tables in front of the serialized media blocks.
+	String Finish()
+	{
+		const uint32_t origin_index = WriteString(origin);
+
+		// Sources are written before the strings to intern any remaining path and rule names.
+		String source_table;
+		std::swap(buffer, source_table);
+		Write((uint32_t)sources.size());
+		for (const PropertySource* source : sources)
+		{
+			Write(WriteString(source->path));
+			Write((int32_t)source->line_number);
+			Write(WriteString(source->rule_name));
+		}
+		std::swap(buffer, source_table);
+
+		String body;
+		std::swap(buffer, body);
+		buffer.reserve(64 + GetStringTableSize() + source_table.size() + body.size());
+
+		WriteHeader(binary_signature, binary_version);
+		Write((uint32_t)sizeof(TransformPrimitive));
+
+		const String library_version = GetVersion();
+		Write((uint32_t)library_version.size());
+		buffer += library_version;
+
+		WriteStringTable();
+		Write(origin_index);
+
+		buffer += source_table;
+		buffer += body;
+
+		return std::move(buffer);
+	}
+
+private:
+	void NotePath(const String& path)
+	{
+		if (!has_origin)
+		{
+			origin = path;
+			has_origin = true;
+		}
+	}
+
+	void WriteSource(const PropertySource* source)
+	{
+		if (!source)
+		{
+			Write((int32_t)-1);
+			return;
+		}
+
+		auto result = source_indices.emplace(source, (int32_t)sources.size());
+		if (result.second)
+		{
+			sources.push_back(source);
+			NotePath(source->path);
+		}
+		Write(result.first->second);
+	}
+
+	void WriteTween(const Tween& tween)
+	{
+		uint8_t type_in = 0, type_out = 0;
+		if (!FindTweenTypes(tween, type_in, type_out))
+		{
+			Log::Message(Log::LT_WARNING, "Cannot serialize tween '%s' in binary style sheet.", tween.to_string().c_str());
+			valid = false;
+		}
+		Write(type_in);
+		Write(type_out);
+	}
+
+	void WriteProperty(const Property& property)
+	{
+		const Variant& value = property.value;
+		const Variant::Type type = value.GetType();
+		Write((uint8_t)type);
+
+		switch (type)
+		{
+		case Variant::NONE: break;
+		case Variant::BOOL: Write((uint8_t)value.GetReference<bool>()); break;
+		case Variant::BYTE: Write(value.GetReference<byte>()); break;
+		case Variant::CHAR: Write(value.GetReference<char>()); break;
+		case Variant::FLOAT: Write(value.GetReference<float>()); break;
+		case Variant::DOUBLE: Write(value.GetReference<double>()); break;
+		case Variant::INT: Write(value.GetReference<int>()); break;
+		case Variant::INT64: Write(value.GetReference<int64_t>()); break;
+		case Variant::UINT: Write(value.GetReference<unsigned int>()); break;
+		case Variant::UINT64: Write(value.GetReference<uint64_t>()); break;
+		case Variant::STRING: Write(WriteString(value.GetReference<String>())); break;
+		case Variant::VECTOR2: Write(value.GetReference<Vector2f>()); break;
+		case Variant::VECTOR3: Write(value.GetReference<Vector3f>()); break;
+		case Variant::VECTOR4: Write(value.GetReference<Vector4f>()); break;
+		case Variant::COLOURF: Write(value.GetReference<Colourf>()); break;
+		case Variant::COLOURB: Write(value.GetReference<Colourb>()); break;
+		case Variant::TRANSFORMPTR:
+		{
+			const TransformPtr& transform = value.GetReference<TransformPtr>();
+			const uint32_t num_primitives = (transform ? (uint32_t)transform->GetNumPrimitives() : 0);
+			Write((uint8_t)(transform != nullptr));
+			Write(num_primitives);
+			if (num_primitives > 0)
+				buffer.append(reinterpret_cast<const char*>(transform->GetPrimitives().data()), num_primitives * sizeof(TransformPrimitive));
+		}
+		break;
+		case Variant::TRANSITIONLIST:
+		{
+			const TransitionList& transition_list = value.GetReference<TransitionList>();
+			Write((uint8_t)transition_list.none);
+			Write((uint8_t)transition_list.all);
+			Write((uint32_t)transition_list.transitions.size());
+			for (const Transition& transition : transition_list.transitions)
+			{
+				Write(WriteString(StyleSheetSpecification::GetPropertyName(transition.id)));
+				WriteTween(transition.tween);
+				Write(transition.duration);
+				Write(transition.delay);
+				Write(transition.reverse_adjustment_factor);
+			}
+		}
+		break;
+		case Variant::ANIMATIONLIST:
+		{
+			const AnimationList& animation_list = value.GetReference<AnimationList>();
+			Write((uint32_t)animation_list.size());
+			for (const Animation& animation : animation_list)
+			{
+				Write(animation.duration);
+				WriteTween(animation.tween);
+				Write(animation.delay);
+				Write((uint8_t)animation.alternate);
+				Write((uint8_t)animation.paused);
+				Write((int32_t)animation.num_iterations);
+				Write(WriteString(animation.name));
+			}
+		}
+		break;
+		// Decorators and font effects hold instanced objects, they are stored by their declaration and parsed again at load.
+		case Variant::DECORATORSPTR:
+		{
+			const DecoratorsPtr& decorators = value.GetReference<DecoratorsPtr>();
+			Write(WriteString(decorators ? decorators->value : String()));
+		}
+		break;
+		case Variant::FONTEFFECTSPTR:
+		{
+			const FontEffectsPtr& font_effects = value.GetReference<FontEffectsPtr>();
+			Write(WriteString(font_effects ? font_effects->value : String()));
+		}
+		break;
+		case Variant::SCRIPTINTERFACE:
+		case Variant::VOIDPTR:
+			Log::Message(Log::LT_WARNING, "Cannot serialize pointer values in binary style sheet.");
+			valid = false;
+			break;
+		}
+
+		Write((int32_t)property.unit);
+		Write((int32_t)property.specificity);
+		Write((int32_t)property.parser_index);
+		WriteSource(property.source.get());
+	}
+
+	// Properties are stored by name when a specification is given, otherwise by their raw id.
+	void WriteProperties(const PropertyDictionary& properties, const PropertySpecification* specification)
+	{
+		Write((uint32_t)properties.GetNumProperties());
+		for (const auto& pair : properties.GetProperties())
+		{
+			if (specification)
+				Write(WriteString(specification->GetPropertyName(pair.first)));
+			else
+				Write((uint32_t)pair.first);
+			WriteProperty(pair.second);
+		}
+	}
+
+	void WriteNode(const StyleSheetNode& node)
+	{
+		Write(WriteString(node.tag));
+		Write(WriteString(node.id));
+
+		Write((uint32_t)node.class_names.size());
+		for (const String& class_name : node.class_names)
+			Write(WriteString(class_name));
+
+		Write((uint32_t)node.pseudo_class_names.size());
+		for (const String& pseudo_class_name : node.pseudo_class_names)
+			Write(WriteString(pseudo_class_name));
+
+		Write((uint32_t)node.structural_selectors.size());
+		for (const StructuralSelector& selector : node.structural_selectors)
+		{
+			Write(WriteString(StyleSheetFactory::GetSelectorName(selector.selector)));
+			Write((int32_t)selector.a);
+			Write((int32_t)selector.b);
+		}
+
+		Write((uint8_t)node.child_combinator);
+
+		WriteProperties(node.properties, &StyleSheetSpecification::GetPropertySpecification());
+
+		Write((uint32_t)node.children.size());
+		for (const auto& child : node.children)
+			WriteNode(*child);
+	}
+
+	void WriteStyleSheet(const StyleSheet& style_sheet)
+	{
+		const PropertySpecification& style_specification = StyleSheetSpecification::GetPropertySpecification();
+
+		Write((int32_t)style_sheet.specificity_offset);
+
+		// Sprite sheets are written first, as decorators may refer to their sprites while being instanced.
+		const SpritesheetList& spritesheet_list = style_sheet.spritesheet_list;
+		Write((uint32_t)spritesheet_list.spritesheets.size());
+		for (const auto& sprite_sheet : spritesheet_list.spritesheets)
+		{
+			NotePath(sprite_sheet->definition_source);
+			Write(WriteString(sprite_sheet->name));
+			Write(WriteString(sprite_sheet->image_source));
+			Write(WriteString(sprite_sheet->definition_source));
+			Write((int32_t)sprite_sheet->definition_line_number);
+			Write(sprite_sheet->display_scale);
+
+			// Only the sprites which were not overwritten by later sprite sheets are written, which is sufficient to reproduce the sprite map.
+			uint32_t num_sprites = 0;
+			for (const auto& sprite : spritesheet_list.sprite_map)
+				num_sprites += (sprite.second.sprite_sheet == sprite_sheet.get() ? 1 : 0);
+
+			Write(num_sprites);
+			for (const auto& sprite : spritesheet_list.sprite_map)
+			{
+				if (sprite.second.sprite_sheet == sprite_sheet.get())
+				{
+					Write(WriteString(sprite.first));
+					Write(sprite.second.rectangle);
+				}
+			}
+		}
+
+		Write((uint32_t)style_sheet.keyframes.size());
+		for (const auto& pair : style_sheet.keyframes)
+		{
+			const Keyframes& keyframes = pair.second;
+			Write(WriteString(pair.first));
+
+			Write((uint32_t)keyframes.property_ids.size());
+			for (PropertyId id : keyframes.property_ids)
+				Write(WriteString(style_specification.GetPropertyName(id)));
+
+			Write((uint32_t)keyframes.blocks.size());
+			for (const KeyframeBlock& block : keyframes.blocks)
+			{
+				Write(block.normalized_time);
+				WriteProperties(block.properties, &style_specification);
+			}
+		}
+
+		Write((uint32_t)style_sheet.decorator_map.size());
+		for (const auto& pair : style_sheet.decorator_map)
+		{
+			const DecoratorSpecification& specification = pair.second;
+			DecoratorInstancer* instancer = Factory::GetDecoratorInstancer(specification.decorator_type);
+			if (!instancer)
+			{
+				Log::Message(Log::LT_WARNING, "Cannot serialize decorator '%s', its type '%s' is not registered.", pair.first.c_str(), specification.decorator_type.c_str());
+				valid = false;
+				return;
+			}
+
+			Write(WriteString(pair.first));
+			Write(WriteString(specification.decorator_type));
+			WriteProperties(specification.properties, &instancer->GetPropertySpecification());
+		}
+
+		// The root node itself can only contain properties.
+		const StyleSheetNode& root = *style_sheet.root;
+		WriteProperties(root.properties, &style_specification);
+		Write((uint32_t)root.children.size());
+		for (const auto& child : root.children)
+			WriteNode(*child);
+	}
+
+	Vector<const PropertySource*> sources;
+	UnorderedMap<const PropertySource*, int32_t> source_indices;
+
+	String origin;
+	bool has_origin = false;
+
+	bool valid = true;
+};
+
+class StyleSheetBinary::Reader {
+public:
+	Reader(const String& data, String source_url) : reader(data.data(), data.data() + data.size()), source_url(std::move(source_url)) {}
+
+	bool ReadMediaBlocks(MediaBlockList& media_blocks)
+	{
+		if (!reader.ReadSignature(binary_signature))
+			return Fail("Invalid signature");
+
+		if (!reader.ReadVersion(binary_version) || Read<uint32_t>() != (uint32_t)sizeof(TransformPrimitive))
+			return Fail("The style sheet was compiled with an incompatible version of the library or for a different platform");
+
+		const char* library_version = nullptr;
+		uint32_t library_version_size = 0;
+		if (!reader.ReadView(library_version, library_version_size) || GetVersion().compare(0, String::npos, library_version, library_version_size) != 0)
+			return Fail("The style sheet was compiled with a different version of the library");
+
+		if (!reader.Read(strings))
+			return Fail("Invalid string table");
+		style_definitions.resize(strings.size(), nullptr);
+
+		origin = ReadString();
+
+		const uint32_t num_sources = ReadCount();
+		sources.reserve(num_sources);
+		for (uint32_t i = 0; i < num_sources && valid; i++)
+		{
+			const String& path = ReadString();
+			const int line_number = Read<int32_t>();
+			const String& rule_name = ReadString();
+			sources.push_back(MakeShared<PropertySource>(RebasePath(path), line_number, rule_name));
+		}
+
+		const uint32_t num_media_blocks = ReadCount();
+		for (uint32_t i = 0; i < num_media_blocks && valid; i++)
+		{
+			MediaBlock media_block{PropertyDictionary{}, SharedPtr<StyleSheet>(new StyleSheet())};
+			ReadProperties(media_block.properties, nullptr);
+			ReadStyleSheet(*media_block.stylesheet);
+			media_blocks.push_back(std::move(media_block));
+		}
+
+		if (valid && !reader.AtEnd())
+			return Fail("Unexpected data at end of file");
+
+		return valid;
+	}
+
+private:
+	bool Fail(const char* reason)
+	{
+		if (valid)
+			Log::Message(Log::LT_WARNING, "Could not load binary style sheet '%s': %s.", source_url.c_str(), reason);
+		valid = false;
+		return false;
+	}
+
+	bool ReadBytes(void* destination, size_t size)
+	{
+		if (!valid || !reader.ReadBytes(destination, size))
+			return Fail("Unexpected end of file");
+		return true;
+	}
+
+	template <typename T>
+	T Read()
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be read directly.");
+		T value = T();
+		ReadBytes(&value, sizeof(T));
+		return value;
+	}
+
+	bool ReadBool() { return Read<uint8_t>() != 0; }
+
+	// Reads an element count, which is never larger than the number of remaining bytes.
+	uint32_t ReadCount()
+	{
+		const uint32_t count = Read<uint32_t>();
+		if ((size_t)count > reader.GetNumRemainingBytes())
+		{
+			Fail("Invalid element count");
+			return 0;
+		}
+		return count;
+	}
+
+	const String& ReadString()
+	{
+		static const String empty_string;
+		const uint32_t index = Read<uint32_t>();
+		if (index >= (uint32_t)strings.size())
+		{
+			Fail("Invalid string index");
+			return empty_string;
+		}
+		return strings[index];
+	}
+
+	// Paths recorded from the compiled style sheet are replaced with the location of the binary file, so that relative paths are resolved from there.
+	String RebasePath(const String& path) const { return path == origin ? source_url : path; }
+
+	Tween ReadTween()
+	{
+		const uint8_t type_in = Read<uint8_t>();
+		const uint8_t type_out = Read<uint8_t>();
+		if (type_in >= (uint8_t)Tween::Callback || type_out >= (uint8_t)Tween::Callback)
+		{
+			Fail("Invalid tween");
+			return Tween();
+		}
+		return Tween((Tween::Type)type_in, (Tween::Type)type_out);
+	}
+
+	// Returns the definition of the property name at the given string index, style properties are resolved only once per name.
+	const PropertyDefinition* ReadPropertyDefinition(const PropertySpecification& specification, bool is_style_specification)
+	{
+		const uint32_t index = Read<uint32_t>();
+		if (index >= (uint32_t)strings.size())
+		{
+			Fail("Invalid string index");
+			return nullptr;
+		}
+
+		const PropertyDefinition* definition = (is_style_specification ? style_definitions[index] : nullptr);
+		if (!definition)
+		{
+			definition = specification.GetProperty(strings[index]);
+			if (!definition)
+			{
+				Log::Message(Log::LT_WARNING, "Unknown property '%s' in binary style sheet '%s'.", strings[index].c_str(), source_url.c_str());
+				Fail("Unknown property");
+				return nullptr;
+			}
+			if (is_style_specification)
+				style_definitions[index] = definition;
+		}
+		return definition;
+	}
+
+	PropertyId ReadStylePropertyId()
+	{
+		const PropertyDefinition* definition = ReadPropertyDefinition(StyleSheetSpecification::GetPropertySpecification(), true);
+		return definition ? definition->GetId() : PropertyId::Invalid;
+	}
+
+	void ReadProperty(Property& property, const PropertyDefinition* definition)
+	{
+		const Variant::Type type = (Variant::Type)Read<uint8_t>();
+		const String* declaration = nullptr;
+
+		switch (type)
+		{
+		case Variant::NONE: break;
+		case Variant::BOOL: property.value = ReadBool(); break;
+		case Variant::BYTE: property.value = Read<byte>(); break;
+		case Variant::CHAR: property.value = Read<char>(); break;
+		case Variant::FLOAT: property.value = Read<float>(); break;
+		case Variant::DOUBLE: property.value = Read<double>(); break;
+		case Variant::INT: property.value = Read<int>(); break;
+		case Variant::INT64: property.value = Read<int64_t>(); break;
+		case Variant::UINT: property.value = Read<unsigned int>(); break;
+		case Variant::UINT64: property.value = Read<uint64_t>(); break;
+		case Variant::STRING: property.value = ReadString(); break;
+		case Variant::VECTOR2: property.value = Read<Vector2f>(); break;
+		case Variant::VECTOR3: property.value = Read<Vector3f>(); break;
+		case Variant::VECTOR4: property.value = Read<Vector4f>(); break;
+		case Variant::COLOURF: property.value = Read<Colourf>(); break;
+		case Variant::COLOURB: property.value = Read<Colourb>(); break;
+		case Variant::TRANSFORMPTR:
+		{
+			const bool has_transform = ReadBool();
+			const uint32_t num_primitives = ReadCount();
+			TransformPtr transform;
+			if (has_transform && valid)
+			{
+				Transform::PrimitiveList primitives(num_primitives, TransformPrimitive(Transforms::TranslateX(0.f)));
+				if (num_primitives > 0 && ReadBytes(primitives.data(), num_primitives * sizeof(TransformPrimitive)))
+				{
+					for (const TransformPrimitive& primitive : primitives)
+					{
+						if (!IsValidTransformPrimitive(primitive))
+						{
+							Fail("Invalid transform primitive");
+							break;
+						}
+					}
+				}
+				transform = MakeShared<Transform>(std::move(primitives));
+			}
+			property.value = std::move(transform);
+		}
+		break;
+		case Variant::TRANSITIONLIST:
+		{
+			TransitionList transition_list;
+			transition_list.none = ReadBool();
+			transition_list.all = ReadBool();
+			transition_list.transitions.resize(ReadCount());
+			for (Transition& transition : transition_list.transitions)
+			{
+				transition.id = ReadStylePropertyId();
+				transition.tween = ReadTween();
+				transition.duration = Read<float>();
+				transition.delay = Read<float>();
+				transition.reverse_adjustment_factor = Read<float>();
+			}
+			property.value = std::move(transition_list);
+		}
+		break;
+		case Variant::ANIMATIONLIST:
+		{
+			AnimationList animation_list(ReadCount());
+			for (Animation& animation : animation_list)
+			{
+				animation.duration = Read<float>();
+				animation.tween = ReadTween();
+				animation.delay = Read<float>();
+				animation.alternate = ReadBool();
+				animation.paused = ReadBool();
+				animation.num_iterations = Read<int32_t>();
+				animation.name = ReadString();
+			}
+			property.value = std::move(animation_list);
+		}
+		break;
+		case Variant::DECORATORSPTR:
+		case Variant::FONTEFFECTSPTR:
+			declaration = &ReadString();
+			break;
+		default:
+			Fail("Invalid property value type");
+			break;
+		}
+
+		const int32_t unit = Read<int32_t>();
+		if (!IsValidUnit(unit))
+			Fail("Invalid property unit");
+		property.unit = (Property::Unit)unit;
+		property.specificity = Read<int32_t>();
+		property.parser_index = Read<int32_t>();
+		property.definition = definition;
+
+		const int32_t source_index = Read<int32_t>();
+		if (source_index >= (int32_t)sources.size())
+			Fail("Invalid source index");
+		else if (source_index >= 0)
+			property.source = sources[source_index];
+
+		if (declaration && valid)
+		{
+			const int specificity = property.specificity;
+			if (!definition || !definition->ParseValue(property, *declaration))
+			{
+				Log::Message(Log::LT_WARNING, "Could not parse '%s' in binary style sheet '%s'.", declaration->c_str(), source_url.c_str());
+				Fail("Invalid property value");
+			}
+			property.specificity = specificity;
+		}
+	}
+
+	void ReadProperties(PropertyDictionary& properties, const PropertySpecification* specification)
+	{
+		const bool is_style_specification = (specification == &StyleSheetSpecification::GetPropertySpecification());
+		const uint32_t num_properties = ReadCount();
+
+		for (uint32_t i = 0; i < num_properties && valid; i++)
+		{
+			PropertyId id = PropertyId::Invalid;
+			const PropertyDefinition* definition = nullptr;
+			if (specification)
+			{
+				definition = ReadPropertyDefinition(*specification, is_style_specification);
+				if (definition)
+					id = definition->GetId();
+			}
+			else
+			{
+				// Media block properties are stored by their media query id.
+				const uint32_t media_query_id = Read<uint32_t>();
+				if (media_query_id == (uint32_t)MediaQueryId::Invalid || media_query_id >= (uint32_t)MediaQueryId::NumDefinedIds)
+					Fail("Invalid media query");
+				id = (PropertyId)media_query_id;
+			}
+
+			Property property;
+			ReadProperty(property, definition);
+			if (valid)
+				properties.SetProperty(id, property);
+		}
+	}
+
+	void ReadNodeChildren(StyleSheetNode& parent)
+	{
+		const uint32_t num_children = ReadCount();
+		parent.children.reserve(num_children);
+
+		for (uint32_t i = 0; i < num_children && valid; i++)
+		{
+			String tag = ReadString();
+			String id = ReadString();
+
+			StringList class_names(ReadCount());
+			for (String& class_name : class_names)
+				class_name = ReadString();
+
+			StringList pseudo_class_names(ReadCount());
+			for (String& pseudo_class_name : pseudo_class_names)
+				pseudo_class_name = ReadString();
+
+			const uint32_t num_structural_selectors = ReadCount();
+			StructuralSelectorList structural_selectors;
+			structural_selectors.reserve(num_structural_selectors);
+			for (uint32_t j = 0; j < num_structural_selectors && valid; j++)
+			{
+				StructuralSelector selector = StyleSheetFactory::GetSelector(ReadString());
+				selector.a = Read<int32_t>();
+				selector.b = Read<int32_t>();
+				if (!selector.selector)
+					Fail("Unknown structural selector");
+				structural_selectors.push_back(selector);
+			}
+
+			const bool child_combinator = ReadBool();
+			if (!valid)
+				break;
+
+			// Nodes are unique by construction, so they can be added directly instead of searching for an equivalent sibling.
+			auto node = MakeUnique<StyleSheetNode>(&parent, std::move(tag), std::move(id), std::move(class_names), std::move(pseudo_class_names),
+				std::move(structural_selectors), child_combinator);
+
+			ReadProperties(node->properties, &StyleSheetSpecification::GetPropertySpecification());
+			ReadNodeChildren(*node);
+
+			parent.children.push_back(std::move(node));
+		}
+	}
+
+	void ReadStyleSheet(StyleSheet& style_sheet)
+	{
+		const PropertySpecification& style_specification = StyleSheetSpecification::GetPropertySpecification();
+
+		style_sheet.specificity_offset = Read<int32_t>();
+
+		const uint32_t num_sprite_sheets = ReadCount();
+		for (uint32_t i = 0; i < num_sprite_sheets && valid; i++)
+		{
+			const String& name = ReadString();
+			const String& image_source = ReadString();
+			const String definition_source = RebasePath(ReadString());
+			const int definition_line_number = Read<int32_t>();
+			const float display_scale = Read<float>();
+
+			SpriteDefinitionList sprite_definitions(ReadCount());
+			for (auto& sprite_definition : sprite_definitions)
+			{
+				sprite_definition.first = ReadString();
+				sprite_definition.second = Read<Rectangle>();
+			}
+
+			if (valid)
+				style_sheet.spritesheet_list.AddSpriteSheet(name, image_source, definition_source, definition_line_number, display_scale, sprite_definitions);
+		}
+
+		const uint32_t num_keyframes = ReadCount();
+		style_sheet.keyframes.reserve(num_keyframes);
+		for (uint32_t i = 0; i < num_keyframes && valid; i++)
+		{
+			Keyframes& keyframes = style_sheet.keyframes[ReadString()];
+
+			keyframes.property_ids.resize(ReadCount());
+			for (PropertyId& id : keyframes.property_ids)
+				id = ReadStylePropertyId();
+
+			const uint32_t num_blocks = ReadCount();
+			keyframes.blocks.reserve(num_blocks);
+			for (uint32_t j = 0; j < num_blocks && valid; j++)
+			{
+				keyframes.blocks.emplace_back(Read<float>());
+				ReadProperties(keyframes.blocks.back().properties, &style_specification);
+			}
+		}
+
+		const uint32_t num_decorators = ReadCount();
+		style_sheet.decorator_map.reserve(num_decorators);
+		for (uint32_t i = 0; i < num_decorators && valid; i++)
+		{
+			String name = ReadString();
+			String decorator_type = ReadString();
+
+			DecoratorInstancer* instancer = Factory::GetDecoratorInstancer(decorator_type);
+			if (!instancer)
+			{
+				Log::Message(Log::LT_WARNING, "Unknown decorator type '%s' in binary style sheet '%s'.", decorator_type.c_str(), source_url.c_str());
+				Fail("Unknown decorator type");
+				break;
+			}
+
+			PropertyDictionary properties;
+			ReadProperties(properties, &instancer->GetPropertySpecification());
+			if (!valid)
+				break;
+
+			// All properties of a decorator share the source of its declaration.
+			const PropertySource* source = nullptr;
+			if (properties.GetNumProperties() > 0)
+				source = properties.GetProperties().begin()->second.source.get();
+
+			SharedPtr<Decorator> decorator = instancer->InstanceDecorator(decorator_type, properties, DecoratorInstancerInterface(style_sheet, source));
+			if (!decorator)
+			{
+				Log::Message(Log::LT_WARNING, "Could not instance decorator '%s' of type '%s' in binary style sheet '%s'.", name.c_str(), decorator_type.c_str(), source_url.c_str());
+				continue;
+			}
+
+			style_sheet.decorator_map.emplace(std::move(name), DecoratorSpecification{ std::move(decorator_type), std::move(properties), std::move(decorator) });
+		}
+
+		ReadProperties(style_sheet.root->properties, &style_specification);
+		ReadNodeChildren(*style_sheet.root);
+	}
+
+	BinaryReader reader;
+	String source_url;
+
+	StringList strings;
+	Vector<const PropertyDefinition*> style_definitions;
+	Vector<SharedPtr<const PropertySource>> sources;
+	String origin;
+
+	bool valid = true;
+};
+
+bool StyleSheetBinary::IsBinaryStream(Stream* stream)
+{
+	char signature[sizeof(binary_signature)] = {};
+	const size_t length = stream->Length();
+	if (length < sizeof(signature) || length - stream->Tell() < sizeof(signature))
+		return false;
+	return stream->Peek(signature, sizeof(signature)) == sizeof(signature) && memcmp(signature, binary_signature, sizeof(signature)) == 0;
+}
+
+bool StyleSheetBinary::Write(const MediaBlockList& media_blocks, Stream* stream)
+{
+	RMLUI_ZoneScoped;
+
+	Writer writer;
+	if (!writer.WriteMediaBlocks(media_blocks))
+		return false;
+
+	const String data = writer.Finish();
+	return stream->Write(data.data(), data.size()) == data.size();
+}
+
+bool StyleSheetBinary::Read(MediaBlockList& media_blocks, Stream* stream)
+{
+	RMLUI_ZoneScoped;
+
+	String data;
+	stream->Read(data, stream->Length() - stream->Tell());
+
+	MediaBlockList new_media_blocks;
+	Reader reader(data, StringUtilities::Replace(stream->GetSourceURL().GetURL(), '|', ':'));
+	if (!reader.ReadMediaBlocks(new_media_blocks))
+		return false;
+
+	for (MediaBlock& media_block : new_media_blocks)
+		media_blocks.push_back(std::move(media_block));
+
+	return true;
+}
+
+} // namespace Rml
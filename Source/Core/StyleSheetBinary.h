@@ -0,0 +1,70 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_STYLESHEETBINARY_H
+#define RMLUI_CORE_STYLESHEETBINARY_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/StyleSheetTypes.h"
+
+namespace Rml {
+
+class Stream;
+
+/**
+	Reads and writes the binary representation of parsed style sheets.
+
+	A binary style sheet stores the media blocks of a style sheet container after parsing, with all properties already
+	validated and converted to their values. Loading one skips the RCSS parser entirely, leaving only a linear decode of
+	the node tree and property values. Property names, decorator types, and selectors are stored by name and resolved
+	once at load, so that the file stays valid across custom property registrations. The format is otherwise tied to the
+	library version, which is stored in the header and any mismatch is rejected at load.
+ */
+
+class StyleSheetBinary
+{
+public:
+	/// Returns true if the stream at its current position starts with the binary style sheet signature.
+	static bool IsBinaryStream(Stream* stream);
+
+	/// Writes the given media blocks in the binary format to the stream.
+	/// @return True on success, false if any of the style sheets contain values which cannot be serialized.
+	static bool Write(const MediaBlockList& media_blocks, Stream* stream);
+
+	/// Reads binary style sheets from the stream into the given media blocks.
+	/// Source locations which were recorded from the original style sheet are rebased onto the source URL of the stream.
+	/// @return True on success, false if the stream is not a valid binary style sheet for this version of the library.
+	static bool Read(MediaBlockList& media_blocks, Stream* stream);
+
+private:
+	class Reader;
+	class Writer;
+};
+
+} // namespace Rml
+#endif
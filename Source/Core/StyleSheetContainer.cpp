@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/Utilities.h"
 #include "ComputeProperty.h"
+#include "StyleSheetBinary.h"
 #include "StyleSheetParser.h"
 
 namespace Rml {
@@ -47,11 +48,19 @@ StyleSheetContainer::~StyleSheetContainer()
 
 bool StyleSheetContainer::LoadStyleSheetContainer(Stream* stream, int begin_line_number)
 {
+	if (StyleSheetBinary::IsBinaryStream(stream))
+		return StyleSheetBinary::Read(media_blocks, stream);
+
 	StyleSheetParser parser;
 	bool result = parser.Parse(media_blocks, stream, begin_line_number);
 	return result;
 }
 
+bool StyleSheetContainer::SaveStyleSheetContainer(Stream* stream) const
+{
+	return StyleSheetBinary::Write(media_blocks, stream);
+}
+
 bool StyleSheetContainer::UpdateCompiledStyleSheet(const Context* context)
 {
 	RMLUI_ZoneScoped;
@@ -62,7 +71,7 @@ bool StyleSheetContainer::UpdateCompiledStyleSheet(const Context* context)
 
 	Vector<int> new_active_media_block_indices;
 
-	const float font_size = DefaultComputedValues.font_size;
+	const float font_size = DefaultComputedValues.inherited->font_size;
 
 	for (int media_block_index = 0; media_block_index < (int)media_blocks.size(); media_block_index++)
 	{
@@ -184,6 +184,17 @@ StructuralSelector StyleSheetFactory::GetSelector(const String& name)
 	return StructuralSelector(it->second.get(), a, b);
 }
 
+const String& StyleSheetFactory::GetSelectorName(const StyleSheetNodeSelector* selector)
+{
+	static const String empty_name;
+	for (const auto& pair : instance->selectors)
+	{
+		if (pair.second.get() == selector)
+			return pair.first;
+	}
+	return empty_name;
+}
+
 UniquePtr<const StyleSheetContainer> StyleSheetFactory::LoadStyleSheetContainer(const String& sheet)
 {
 	UniquePtr<StyleSheetContainer> new_style_sheet;
@@ -65,6 +65,8 @@ public:
 	/// @param name[in] The name of the desired selector.
 	/// @return The selector registered with the given name, or nullptr if none exists.
 	static StructuralSelector GetSelector(const String& name);
+	/// Returns the name a node selector was registered with, or an empty string if it is not registered.
+	static const String& GetSelectorName(const StyleSheetNodeSelector* selector);
 
 private:
 	StyleSheetFactory();
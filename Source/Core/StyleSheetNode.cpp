@@ -45,12 +45,14 @@ StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const String& tag, const
 	: parent(parent), tag(tag), id(id), class_names(classes), pseudo_class_names(pseudo_classes), structural_selectors(structural_selectors), child_combinator(child_combinator)
 {
 	CalculateAndSetSpecificity();
+	CalculateAncestorFilterHashes();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, String&& tag, String&& id, StringList&& classes, StringList&& pseudo_classes, StructuralSelectorList&& structural_selectors, bool child_combinator)
 	: parent(parent), tag(std::move(tag)), id(std::move(id)), class_names(std::move(classes)), pseudo_class_names(std::move(pseudo_classes)), structural_selectors(std::move(structural_selectors)), child_combinator(child_combinator)
 {
 	CalculateAndSetSpecificity();
+	CalculateAncestorFilterHashes();
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const StyleSheetNode& other)
@@ -150,6 +152,11 @@ void StyleSheetNode::BuildIndex(StyleSheetIndex& styled_node_index) const
 		{
 			IndexInsertNode(styled_node_index.tags, tag, this);
 		}
+		else if (!pseudo_class_names.empty())
+		{
+			// Elements usually have few active pseudo classes, so looking these up is much faster than testing every node.
+			IndexInsertNode(styled_node_index.pseudo_classes, pseudo_class_names.front(), this);
+		}
 		else
 		{
 			styled_node_index.other.push_back(this);
@@ -338,4 +345,21 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void StyleSheetNode::CalculateAncestorFilterHashes()
+{
+	ancestor_filter_hashes.clear();
+	if (!parent)
+		return;
+
+	// Each of our parent nodes must be matched by a distinct ancestor of the element, thus all their requirements must be present.
+	ancestor_filter_hashes = parent->ancestor_filter_hashes;
+
+	if (!parent->tag.empty())
+		ancestor_filter_hashes.push_back(AncestorFilter::Hash(AncestorFilter::KeyType::Tag, parent->tag));
+	if (!parent->id.empty())
+		ancestor_filter_hashes.push_back(AncestorFilter::Hash(AncestorFilter::KeyType::Id, parent->id));
+	for (const String& class_name : parent->class_names)
+		ancestor_filter_hashes.push_back(AncestorFilter::Hash(AncestorFilter::KeyType::Class, class_name));
+}
+
 } // namespace Rml
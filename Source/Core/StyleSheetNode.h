@@ -31,11 +31,13 @@
 
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AncestorFilter.h"
 #include <tuple>
 
 namespace Rml {
 
 struct StyleSheetIndex;
+class StyleSheetBinary;
 class StyleSheetNode;
 class StyleSheetNodeSelector;
 
@@ -90,6 +92,8 @@ public:
 
 	/// Returns true if this node is applicable to the given element, given its IDs, classes and heritage.
 	bool IsApplicable(const Element* element) const;
+	/// Returns false if this node requires an ancestor tag, ID or class which is definitely not present in the filter.
+	inline bool MayMatchAncestors(const AncestorFilter& ancestor_filter) const;
 
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
@@ -103,6 +107,7 @@ private:
 	bool EqualRequirements(const String& tag, const String& id, const StringList& classes, const StringList& pseudo_classes, const StructuralSelectorList& structural_pseudo_classes, bool child_combinator) const;
 
 	void CalculateAndSetSpecificity();
+	void CalculateAncestorFilterHashes();
 
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element) const;
@@ -127,10 +132,25 @@ private:
 	// node with a lower value.
 	int specificity = 0;
 
+	// Hashes of the tags, IDs and classes required by our ancestor nodes, used for rejecting elements early.
+	Vector<uint32_t> ancestor_filter_hashes;
+
 	PropertyDictionary properties;
 
 	StyleSheetNodeList children;
+
+	friend class Rml::StyleSheetBinary;
 };
 
+inline bool StyleSheetNode::MayMatchAncestors(const AncestorFilter& ancestor_filter) const
+{
+	for (uint32_t hash : ancestor_filter_hashes)
+	{
+		if (!ancestor_filter.MayContain(hash))
+			return false;
+	}
+	return true;
+}
+
 } // namespace Rml
 #endif
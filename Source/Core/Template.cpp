@@ -27,6 +27,7 @@
  */
 
 #include "Template.h"
+#include "DocumentCache.h"
 #include "XMLParseTools.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/XMLParser.h"
@@ -103,10 +104,23 @@ bool Template::Load(Stream* stream)
 
 	header = *parser.GetDocumentHeader();
 
-	// Store the body in stream form
-	body = MakeUnique<StreamMemory>(body_end - body_start);	
+	body = MakeUnique<StreamMemory>(body_end - body_start);
 	body->SetSourceURL(stream->GetSourceURL());
-	body->PushBack(body_start, body_end - body_start);
+
+	if (!DocumentCache::IsEnabled())
+	{
+		// Store the body in stream form
+		body->PushBack(body_start, body_end - body_start);
+		return true;
+	}
+
+	// With the document cache enabled, store the body in compiled form so that it is not parsed again every time the template is instanced
+	StreamMemory body_source((const byte*) body_start, body_end - body_start);
+	body_source.SetSourceURL(stream->GetSourceURL());
+
+	XMLParser body_parser(nullptr);
+	if (!body_parser.Compile(&body_source, body.get()))
+		return false;
 
 	return true;
 }
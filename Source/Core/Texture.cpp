@@ -29,6 +29,7 @@
 #include "../../Include/RmlUi/Core/Texture.h"
 #include "TextureDatabase.h"
 #include "TextureResource.h"
+#include "WorkerPool.h"
 
 namespace Rml {
 
@@ -60,6 +61,14 @@ TextureHandle Texture::GetHandle(RenderInterface* render_interface) const
 	if (!resource)
 		return 0;
 
+	// Textures are loaded through the render interface, which is only used on the thread updating the context.
+	if (WorkerPool::IsInParallelLoop())
+	{
+		TextureHandle handle = 0;
+		WorkerPool::RunOnCallingThread([&]() { handle = resource->GetHandle(render_interface); });
+		return handle;
+	}
+
 	return resource->GetHandle(render_interface);
 }
 
@@ -69,6 +78,13 @@ Vector2i Texture::GetDimensions(RenderInterface* render_interface) const
 	if (!resource)
 		return Vector2i(0, 0);
 
+	if (WorkerPool::IsInParallelLoop())
+	{
+		Vector2i dimensions;
+		WorkerPool::RunOnCallingThread([&]() { dimensions = resource->GetDimensions(render_interface); });
+		return dimensions;
+	}
+
 	return resource->GetDimensions(render_interface);
 }
 
@@ -31,10 +31,14 @@
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "TextureResource.h"
+#include <mutex>
 
 namespace Rml {
 
 static TextureDatabase* texture_database = nullptr;
+static uint64_t release_textures_counter = 0;
+// Textures may be fetched and created on worker threads while documents are updated in parallel.
+static std::mutex texture_database_mutex;
 
 TextureDatabase::TextureDatabase()
 {
@@ -84,6 +88,7 @@ SharedPtr<TextureResource> TextureDatabase::Fetch(const String& source, const St
 	else
 		GetSystemInterface()->JoinPath(path, StringUtilities::Replace(source_directory, '|', ':'), source);
 
+	std::lock_guard<std::mutex> lock(texture_database_mutex);
 	auto iterator = texture_database->textures.find(path);
 	if (iterator != texture_database->textures.end())
 		return iterator->second;
@@ -97,12 +102,14 @@ SharedPtr<TextureResource> TextureDatabase::Fetch(const String& source, const St
 
 void TextureDatabase::AddCallbackTexture(TextureResource* texture)
 {
+	std::lock_guard<std::mutex> lock(texture_database_mutex);
 	if (texture_database)
 		texture_database->callback_textures.insert(texture);
 }
 
 void TextureDatabase::RemoveCallbackTexture(TextureResource* texture)
 {
+	std::lock_guard<std::mutex> lock(texture_database_mutex);
 	if (texture_database)
 		texture_database->callback_textures.erase(texture);
 }
@@ -111,6 +118,7 @@ StringList TextureDatabase::GetSourceList()
 {
 	StringList result;
 
+	std::lock_guard<std::mutex> lock(texture_database_mutex);
 	if (texture_database)
 	{
 		result.reserve(texture_database->textures.size());
@@ -124,6 +132,9 @@ StringList TextureDatabase::GetSourceList()
 
 void TextureDatabase::ReleaseTextures(RenderInterface* render_interface)
 {
+	release_textures_counter += 1;
+
+	std::lock_guard<std::mutex> lock(texture_database_mutex);
 	if (texture_database)
 	{
 		for (const auto& texture : texture_database->textures)
@@ -134,6 +145,16 @@ void TextureDatabase::ReleaseTextures(RenderInterface* render_interface)
 	}
 }
 
+uint64_t TextureDatabase::GetReleaseTexturesCounter()
+{
+	return release_textures_counter;
+}
+
+void TextureDatabase::NotifyTexturesReleased()
+{
+	release_textures_counter += 1;
+}
+
 bool TextureDatabase::HoldsReferenceToRenderInterface(RenderInterface* render_interface)
 {
 	if (texture_database)
@@ -30,6 +30,7 @@
 #define RMLUI_CORE_TEXTUREDATABASE_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include <stdint.h>
 
 namespace Rml {
 
@@ -53,6 +54,10 @@ public:
 	/// Release all textures bound through a render interface.
 	/// Pass nullptr to release all textures in the database.
 	static void ReleaseTextures(RenderInterface* render_interface = nullptr);
+	/// Returns the number of calls made to ReleaseTextures(), can be used to detect when texture handles may have expired.
+	static uint64_t GetReleaseTexturesCounter();
+	/// Increments the release textures counter, to be called when texture handles in use have been released outside of ReleaseTextures().
+	static void NotifyTexturesReleased();
 
 	/// Adds a texture resource with a callback function and stores it as a weak (raw) pointer in the database.
 	static void AddCallbackTexture(TextureResource* texture);
@@ -86,16 +86,24 @@ int TextureLayout::GetNumTextures() const
 }
 
 // Attempts to generate an efficient texture layout for the rectangles.
-bool TextureLayout::GenerateLayout(int max_texture_dimensions)
+bool TextureLayout::GenerateLayout(int max_texture_dimensions, int min_texture_dimensions)
 {
-	// Sort the rectangles by height.
-	std::sort(rectangles.begin(), rectangles.end(), RectangleSort());
+	// Sort the unplaced rectangles by height. Rectangles placed by a previous generation are referred to by index from
+	// the textures' rows, so they must stay where they are.
+	auto it_first_unplaced = std::find_if(rectangles.begin(), rectangles.end(), [](const TextureLayoutRectangle& rectangle) { return !rectangle.IsPlaced(); });
+	RMLUI_ASSERT(std::none_of(it_first_unplaced, rectangles.end(), [](const TextureLayoutRectangle& rectangle) { return rectangle.IsPlaced(); }));
+	std::sort(it_first_unplaced, rectangles.end(), RectangleSort());
+
+	int num_placed_rectangles = int(it_first_unplaced - rectangles.begin());
+
+	// Fill any free space in the existing textures first.
+	for (int i = 0; i < GetNumTextures() && num_placed_rectangles != GetNumRectangles(); ++i)
+		num_placed_rectangles += textures[i].Append(*this, i);
 
-	int num_placed_rectangles = 0;
 	while (num_placed_rectangles != GetNumRectangles())
 	{
 		TextureLayoutTexture texture;
-		int texture_size = texture.Generate(*this, max_texture_dimensions);
+		int texture_size = texture.Generate(*this, max_texture_dimensions, min_texture_dimensions);
 		if (texture_size == 0)
 			return false;
 
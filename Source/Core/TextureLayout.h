@@ -69,10 +69,14 @@ public:
 	/// @return The layout's texture count.
 	int GetNumTextures() const;
 
-	/// Attempts to generate an efficient texture layout for the rectangles.
+	/// Attempts to generate an efficient texture layout for the rectangles. Rectangles may be added after the layout
+	/// has been generated, then generating the layout again positions only the new rectangles. They are placed in the
+	/// free space of the existing textures if possible, otherwise new textures are added. Previously placed rectangles
+	/// keep their position.
 	/// @param[in] max_texture_dimensions The maximum dimensions allowed for any single texture.
+	/// @param[in] min_texture_dimensions The minimum dimensions of any new texture.
 	/// @return True if the layout was generated successfully, false if not.
-	bool GenerateLayout(int max_texture_dimensions);
+	bool GenerateLayout(int max_texture_dimensions, int min_texture_dimensions = 0);
 
 private:
 	using RectangleList = Vector< TextureLayoutRectangle >;
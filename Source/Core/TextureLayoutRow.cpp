@@ -34,6 +34,8 @@ namespace Rml {
 TextureLayoutRow::TextureLayoutRow()
 {
 	height = 0;
+	width = 1;
+	y = 0;
 }
 
 TextureLayoutRow::~TextureLayoutRow()
@@ -41,9 +43,10 @@ TextureLayoutRow::~TextureLayoutRow()
 }
 
 // Attempts to position unplaced rectangles from the layout into this row.
-int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
+int TextureLayoutRow::Generate(TextureLayout& layout, int texture_index, int max_width, int _y)
 {
-	int width = 1;
+	y = _y;
+	width = 1;
 	int first_unplaced_index = 0;
 	int placed_rectangles = 0;
 
@@ -70,8 +73,8 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 		height = Math::Max(height, rectangle.GetDimensions().y);
 
 		// Add this glyph onto our list and mark it as placed.
-		rectangles.push_back(&rectangle);
-		rectangle.Place(layout.GetNumTextures(), Vector2i(width, y));
+		rectangles.push_back(index);
+		rectangle.Place(texture_index, Vector2i(width, y));
 		++placed_rectangles;
 
 		// Increment our width. An extra pixel is added on so the rectangles aren't pushed up
@@ -85,11 +88,30 @@ int TextureLayoutRow::Generate(TextureLayout& layout, int max_width, int y)
 	return placed_rectangles;
 }
 
+// Attempts to position an unplaced rectangle at the end of this row.
+bool TextureLayoutRow::Append(TextureLayout& layout, int rectangle_index, int texture_index, int max_width)
+{
+	TextureLayoutRectangle& rectangle = layout.GetRectangle(rectangle_index);
+	RMLUI_ASSERT(!rectangle.IsPlaced());
+
+	const Vector2i dimensions = rectangle.GetDimensions();
+	if (dimensions.y > height || width + dimensions.x + 1 > max_width)
+		return false;
+
+	rectangles.push_back(rectangle_index);
+	rectangle.Place(texture_index, Vector2i(width, y));
+
+	if (dimensions.x > 0)
+		width += dimensions.x + 1;
+
+	return true;
+}
+
 // Assigns allocated texture data to all rectangles in this row.
-void TextureLayoutRow::Allocate(byte* texture_data, int stride)
+void TextureLayoutRow::Allocate(TextureLayout& layout, byte* texture_data, int stride)
 {
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Allocate(texture_data, stride);
+	for (int index : rectangles)
+		layout.GetRectangle(index).Allocate(texture_data, stride);
 }
 
 // Returns the height of the row.
@@ -98,11 +120,23 @@ int TextureLayoutRow::GetHeight() const
 	return height;
 }
 
+// Returns the width of the row occupied by its rectangles.
+int TextureLayoutRow::GetWidth() const
+{
+	return width;
+}
+
+// Returns the y-coordinate of the row.
+int TextureLayoutRow::GetY() const
+{
+	return y;
+}
+
 // Resets the placed status for all of the rectangles within this row.
-void TextureLayoutRow::Unplace()
+void TextureLayoutRow::Unplace(TextureLayout& layout)
 {
-	for (size_t i = 0; i < rectangles.size(); ++i)
-		rectangles[i]->Unplace();
+	for (int index : rectangles)
+		layout.GetRectangle(index).Unplace();
 }
 
 } // namespace Rml
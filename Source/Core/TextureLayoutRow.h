@@ -49,28 +49,48 @@ public:
 
 	/// Attempts to position unplaced rectangles from the layout into this row.
 	/// @param[in] layout The layout to position rectangles from.
+	/// @param[in] texture_index The index of the texture this row is placed on.
 	/// @param[in] width The maximum width of this row.
 	/// @param[in] y The y-coordinate of this row.
 	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int width, int y);
+	int Generate(TextureLayout& layout, int texture_index, int width, int y);
+
+	/// Attempts to position an unplaced rectangle at the end of this row, without moving the rectangles already placed.
+	/// @param[in] layout The layout containing the rectangle.
+	/// @param[in] rectangle_index The index of the rectangle to position.
+	/// @param[in] texture_index The index of the texture this row is placed on.
+	/// @param[in] width The maximum width of this row.
+	/// @return True if the rectangle fits within the row's height and remaining width, and was placed.
+	bool Append(TextureLayout& layout, int rectangle_index, int texture_index, int width);
 
 	/// Assigns allocated texture data to all rectangles in this row.
+	/// @param[in] layout The layout containing the row's rectangles.
 	/// @param[in] texture_data The pointer to the beginning of the texture's data.
 	/// @param[in] stride The stride of the texture's surface, in bytes;
-	void Allocate(byte* texture_data, int stride);
+	void Allocate(TextureLayout& layout, byte* texture_data, int stride);
 
 	/// Returns the height of the row.
 	/// @return The row's height.
 	int GetHeight() const;
+	/// Returns the width of the row occupied by its rectangles.
+	/// @return The row's used width.
+	int GetWidth() const;
+	/// Returns the y-coordinate of the row.
+	/// @return The row's y-coordinate.
+	int GetY() const;
 
 	/// Resets the placed status for all of the rectangles within this row.
-	void Unplace();
+	/// @param[in] layout The layout containing the row's rectangles.
+	void Unplace(TextureLayout& layout);
 
 private:
-	using RectangleList = Vector< TextureLayoutRectangle* >;
+	// The rectangles are referred to by index, as the layout may add further rectangles after the row has been generated.
+	using RectangleIndexList = Vector< int >;
 
 	int height;
-	RectangleList rectangles;
+	int width;
+	int y;
+	RectangleIndexList rectangles;
 };
 
 } // namespace Rml
@@ -47,7 +47,7 @@ Vector2i TextureLayoutTexture::GetDimensions() const
 }
 
 // Attempts to position unplaced rectangles from the layout into this texture.
-int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions)
+int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions, int minimum_dimensions)
 {
 	// Come up with an estimate for how big a texture we need. Calculate the total square pixels
 	// required by the remaining rectangles to place, square-root it to get the dimensions of the
@@ -74,8 +74,8 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 	dimensions.y = Math::ToPowerOfTwo(texture_width);
 	dimensions.x = dimensions.y >> 1;
 
-	dimensions.x = Math::Min(dimensions.x, maximum_dimensions);
-	dimensions.y = Math::Min(dimensions.y, maximum_dimensions);
+	dimensions.x = Math::Min(Math::Max(dimensions.x, minimum_dimensions), maximum_dimensions);
+	dimensions.y = Math::Min(Math::Max(dimensions.y, minimum_dimensions), maximum_dimensions);
 
 	// Now we're layout out the rectangles in the texture. If we don't fit all the rectangles on
 	// and have room to grow (ie, haven't hit the maximum texture size in both dimensions) then
@@ -89,7 +89,7 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 		while (num_placed_rectangles != unplaced_rectangles)
 		{
 			TextureLayoutRow row;
-			int row_size = row.Generate(layout, dimensions.x, height);
+			int row_size = row.Generate(layout, layout.GetNumTextures(), dimensions.x, height);
 			if (row_size == 0)
 			{
 				success = false;
@@ -100,7 +100,7 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 			if (height > dimensions.y)
 			{
 				// D'oh! We've exceeded our height boundaries. This row should be unplaced.
-				row.Unplace();
+				row.Unplace(layout);
 				success = false;
 				break;
 			}
@@ -128,15 +128,67 @@ int TextureLayoutTexture::Generate(TextureLayout& layout, int maximum_dimensions
 
 		// Unplace all of the glyphs we tried to place and have an other crack.
 		for (size_t i = 0; i < rows.size(); i++)
-			rows[i].Unplace();
+			rows[i].Unplace(layout);
 
 		rows.clear();
 		num_placed_rectangles = 0;
 	}
 }
 
+// Attempts to position unplaced rectangles from the layout into the free space of this texture.
+int TextureLayoutTexture::Append(TextureLayout& layout, int texture_index)
+{
+	int num_placed_rectangles = 0;
+
+	// First fill up the space at the end of the existing rows, choosing the lowest row the rectangle fits within.
+	for (int i = 0; i < layout.GetNumRectangles(); ++i)
+	{
+		if (layout.GetRectangle(i).IsPlaced())
+			continue;
+
+		const int rectangle_height = layout.GetRectangle(i).GetDimensions().y;
+		const int rectangle_width = layout.GetRectangle(i).GetDimensions().x;
+
+		TextureLayoutRow* best_row = nullptr;
+		for (TextureLayoutRow& row : rows)
+		{
+			if (row.GetHeight() >= rectangle_height && row.GetWidth() + rectangle_width + 1 <= dimensions.x &&
+				(!best_row || row.GetHeight() < best_row->GetHeight()))
+				best_row = &row;
+		}
+
+		if (best_row && best_row->Append(layout, i, texture_index, dimensions.x))
+			++num_placed_rectangles;
+	}
+
+	// Then add new rows below the existing ones.
+	int height = 1;
+	if (!rows.empty())
+		height = rows.back().GetY() + rows.back().GetHeight() + 1;
+
+	for (;;)
+	{
+		TextureLayoutRow row;
+		int row_size = row.Generate(layout, texture_index, dimensions.x, height);
+		if (row_size == 0)
+			break;
+
+		height += row.GetHeight() + 1;
+		if (height > dimensions.y)
+		{
+			row.Unplace(layout);
+			break;
+		}
+
+		rows.push_back(row);
+		num_placed_rectangles += row_size;
+	}
+
+	return num_placed_rectangles;
+}
+
 // Allocates the texture.
-UniquePtr<byte[]> TextureLayoutTexture::AllocateTexture()
+UniquePtr<byte[]> TextureLayoutTexture::AllocateTexture(TextureLayout& layout)
 {
 	// Note: this object does not free this texture data. It is freed in the font texture loader.
 	UniquePtr<byte[]> texture_data;
@@ -151,7 +203,7 @@ UniquePtr<byte[]> TextureLayoutTexture::AllocateTexture()
 			((unsigned int*)(texture_data.get()))[i] = 0x00ffffff;
 
 		for (size_t i = 0; i < rows.size(); ++i)
-			rows[i].Allocate(texture_data.get(), dimensions.x * 4);
+			rows[i].Allocate(layout, texture_data.get(), dimensions.x * 4);
 	}
 
 	return texture_data;
@@ -58,12 +58,21 @@ public:
 	/// this texture will be determined by its contents.
 	/// @param[in] layout The layout to position rectangles from.
 	/// @param[in] maximum_dimensions The maximum dimensions of this texture. If this is not big enough to place all the rectangles, then as many will be placed as possible.
+	/// @param[in] minimum_dimensions The minimum dimensions of this texture, can be used to leave free space for rectangles added to the layout later.
 	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int maximum_dimensions);
+	int Generate(TextureLayout& layout, int maximum_dimensions, int minimum_dimensions = 0);
+
+	/// Attempts to position unplaced rectangles from the layout into the free space of this previously generated
+	/// texture, without moving any of the rectangles already placed. The dimensions of the texture are not changed.
+	/// @param[in] layout The layout to position rectangles from.
+	/// @param[in] texture_index The index of this texture within the layout.
+	/// @return The number of placed rectangles.
+	int Append(TextureLayout& layout, int texture_index);
 
 	/// Allocates the texture.
+	/// @param[in] layout The layout containing the texture's rectangles.
 	/// @return The allocated texture data.
-	UniquePtr<byte[]> AllocateTexture();
+	UniquePtr<byte[]> AllocateTexture(TextureLayout& layout);
 
 private:
 	using RowList = Vector< TextureLayoutRow >;
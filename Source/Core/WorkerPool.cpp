@@ -0,0 +1,301 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "WorkerPool.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+
+// Keep the number of threads low, the pool is only intended to offload occasional heavy work from the main thread.
+static constexpr unsigned int max_num_worker_threads = 4;
+
+struct WorkerPoolEntry {
+	WorkerPool::Task task;
+	WorkerPool::Task on_completed;
+};
+
+struct WorkerPoolData {
+	~WorkerPoolData();
+
+	Vector<std::thread> threads;
+
+	std::mutex mutex;
+	std::condition_variable task_available;
+	std::condition_variable tasks_finished;
+
+	Queue<WorkerPoolEntry> tasks;
+	Vector<WorkerPool::Task> completed_tasks;
+	int num_running_tasks = 0;
+	bool shutdown = false;
+};
+
+static UniquePtr<WorkerPoolData> worker_pool;
+
+struct ParallelLoop {
+	int count = 0;
+	const Function<void(int)>* function = nullptr;
+	std::atomic<int> next_index{0};
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	int num_finished = 0;
+	// Tasks forwarded to the calling thread, the entries are owned by the waiting worker threads.
+	Vector<std::pair<const WorkerPool::Task*, bool*>> calling_thread_tasks;
+};
+
+// Set on the worker threads while they run the functions of a parallel loop.
+static thread_local ParallelLoop* current_parallel_loop = nullptr;
+// Set on any thread while it is running a parallel loop.
+static thread_local bool is_running_parallel_loop = false;
+
+static void RunCallingThreadTasks(ParallelLoop& loop, std::unique_lock<std::mutex>& lock)
+{
+	while (!loop.calling_thread_tasks.empty())
+	{
+		Vector<std::pair<const WorkerPool::Task*, bool*>> tasks;
+		tasks.swap(loop.calling_thread_tasks);
+
+		lock.unlock();
+		for (auto& entry : tasks)
+			(*entry.first)();
+		lock.lock();
+
+		for (auto& entry : tasks)
+			*entry.second = true;
+		loop.condition.notify_all();
+	}
+}
+
+static void RunParallelLoopIndices(ParallelLoop& loop, const bool is_calling_thread)
+{
+	while (true)
+	{
+		// Indices are claimed first, the function and loop are only guaranteed to be valid while any claimed index is unfinished.
+		const int index = loop.next_index.fetch_add(1);
+		if (index >= loop.count)
+			break;
+
+		(*loop.function)(index);
+
+		std::unique_lock<std::mutex> lock(loop.mutex);
+		loop.num_finished += 1;
+		if (is_calling_thread)
+			RunCallingThreadTasks(loop, lock);
+		else if (loop.num_finished == loop.count)
+			loop.condition.notify_all();
+	}
+}
+
+static void WorkerThreadMain(WorkerPoolData* pool)
+{
+	std::unique_lock<std::mutex> lock(pool->mutex);
+
+	while (true)
+	{
+		pool->task_available.wait(lock, [pool] { return pool->shutdown || !pool->tasks.empty(); });
+
+		if (pool->tasks.empty())
+			break;
+
+		WorkerPoolEntry entry = std::move(pool->tasks.front());
+		pool->tasks.pop();
+		pool->num_running_tasks += 1;
+
+		lock.unlock();
+		entry.task();
+		entry.task = nullptr;
+		lock.lock();
+
+		if (entry.on_completed)
+			pool->completed_tasks.push_back(std::move(entry.on_completed));
+
+		pool->num_running_tasks -= 1;
+		if (pool->tasks.empty() && pool->num_running_tasks == 0)
+			pool->tasks_finished.notify_all();
+	}
+}
+
+WorkerPoolData::~WorkerPoolData()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		shutdown = true;
+	}
+	task_available.notify_all();
+
+	// The threads finish any remaining tasks before exiting. Their completion functions are discarded.
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+void WorkerPool::Initialise(const int num_threads)
+{
+	RMLUI_ASSERTMSG(!worker_pool, "WorkerPool::Initialise() called, but the pool is already running.");
+	if (worker_pool)
+		return;
+
+	worker_pool = MakeUnique<WorkerPoolData>();
+
+	unsigned int num_worker_threads = (unsigned int)num_threads;
+	if (num_threads < 0)
+	{
+		// Leave one hardware thread for the main thread. Use at least one worker thread, so that heavy tasks never stall the main thread.
+		const unsigned int hardware_threads = std::thread::hardware_concurrency();
+		num_worker_threads = std::min(std::max(hardware_threads, 2u) - 1, max_num_worker_threads);
+	}
+
+	for (unsigned int i = 0; i < num_worker_threads; i++)
+		worker_pool->threads.emplace_back(WorkerThreadMain, worker_pool.get());
+}
+
+void WorkerPool::Shutdown()
+{
+	worker_pool.reset();
+}
+
+void WorkerPool::Submit(Task task)
+{
+	Submit(std::move(task), nullptr);
+}
+
+void WorkerPool::Submit(Task task, Task on_completed)
+{
+	if (!worker_pool || worker_pool->threads.empty())
+	{
+		task();
+		if (on_completed)
+			on_completed();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(worker_pool->mutex);
+		worker_pool->tasks.push(WorkerPoolEntry{std::move(task), std::move(on_completed)});
+	}
+	worker_pool->task_available.notify_one();
+}
+
+void WorkerPool::ProcessCompletedTasks()
+{
+	if (!worker_pool)
+		return;
+
+	Vector<Task> completed_tasks;
+	{
+		std::lock_guard<std::mutex> lock(worker_pool->mutex);
+		completed_tasks.swap(worker_pool->completed_tasks);
+	}
+
+	// Completion functions may submit new tasks, thus they are called without holding the lock.
+	for (Task& on_completed : completed_tasks)
+		on_completed();
+}
+
+void WorkerPool::Wait()
+{
+	if (!worker_pool || worker_pool->threads.empty())
+		return;
+
+	std::unique_lock<std::mutex> lock(worker_pool->mutex);
+	worker_pool->tasks_finished.wait(lock, [] { return worker_pool->tasks.empty() && worker_pool->num_running_tasks == 0; });
+}
+
+void WorkerPool::ParallelFor(const int count, const Function<void(int)>& function)
+{
+	const int num_helpers = std::min(count - 1, GetNumThreads());
+
+	if (num_helpers <= 0 || is_running_parallel_loop)
+	{
+		for (int i = 0; i < count; i++)
+			function(i);
+		return;
+	}
+
+	is_running_parallel_loop = true;
+
+	SharedPtr<ParallelLoop> loop = MakeShared<ParallelLoop>();
+	loop->count = count;
+	loop->function = &function;
+
+	// Helpers which are only started after all indices have been claimed return immediately, the shared loop state keeps them valid.
+	for (int i = 0; i < num_helpers; i++)
+	{
+		Submit([loop]() {
+			current_parallel_loop = loop.get();
+			is_running_parallel_loop = true;
+			RunParallelLoopIndices(*loop, false);
+			is_running_parallel_loop = false;
+			current_parallel_loop = nullptr;
+		});
+	}
+
+	RunParallelLoopIndices(*loop, true);
+
+	std::unique_lock<std::mutex> lock(loop->mutex);
+	while (true)
+	{
+		RunCallingThreadTasks(*loop, lock);
+		if (loop->num_finished == loop->count)
+			break;
+		loop->condition.wait(lock, [&loop] { return loop->num_finished == loop->count || !loop->calling_thread_tasks.empty(); });
+	}
+
+	is_running_parallel_loop = false;
+}
+
+void WorkerPool::RunOnCallingThread(const Task& task)
+{
+	ParallelLoop* loop = current_parallel_loop;
+	if (!loop)
+	{
+		task();
+		return;
+	}
+
+	bool done = false;
+	std::unique_lock<std::mutex> lock(loop->mutex);
+	loop->calling_thread_tasks.emplace_back(&task, &done);
+	loop->condition.notify_all();
+	loop->condition.wait(lock, [&done] { return done; });
+}
+
+bool WorkerPool::IsInParallelLoop()
+{
+	return current_parallel_loop != nullptr;
+}
+
+int WorkerPool::GetNumThreads()
+{
+	return worker_pool ? (int)worker_pool->threads.size() : 0;
+}
+
+} // namespace Rml
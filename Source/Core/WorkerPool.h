@@ -0,0 +1,86 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_WORKERPOOL_H
+#define RMLUI_CORE_WORKERPOOL_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	A small pool of worker threads for running self-contained tasks in the background.
+
+	Tasks must not touch any state shared with the main thread, other than the data they own or which is guaranteed to
+	outlive them. Results are published to the main thread through completion functions, which are called during updates.
+
+	Parallel loops are the exception, the main thread blocks while they run, and their functions may forward any calls
+	which are not safe to make concurrently back to it.
+ */
+
+class WorkerPool {
+public:
+	using Task = Function<void()>;
+
+	/// Starts the worker threads. Must not be called while the pool is already running.
+	/// @param[in] num_threads The number of worker threads, or a negative value to choose one based on the hardware. With zero
+	///                        threads, all tasks are run immediately on the thread submitting them.
+	static void Initialise(int num_threads = -1);
+	/// Finishes any queued tasks and stops the worker threads.
+	static void Shutdown();
+
+	/// Queues a task to be run on one of the worker threads.
+	/// If the pool is not running, the task is run immediately on the calling thread.
+	static void Submit(Task task);
+	/// Queues a task to be run on one of the worker threads, the completion function is called on the main thread during
+	/// the next call to ProcessCompletedTasks() after the task has finished.
+	/// If the pool is not running, both functions are called immediately on the calling thread.
+	static void Submit(Task task, Task on_completed);
+
+	/// Calls the completion functions of all finished tasks. Must only be called from the main thread.
+	static void ProcessCompletedTasks();
+
+	/// Blocks until all submitted tasks have finished running.
+	static void Wait();
+
+	/// Calls the function once for every index in [0, count), spread over the worker threads and the calling thread.
+	/// Returns when all calls have finished. Nested loops are run serially on the thread calling them.
+	static void ParallelFor(int count, const Function<void(int)>& function);
+	/// When called by a worker thread within a parallel loop, runs the task on the thread which started the loop and blocks
+	/// until it has finished. Otherwise, the task is run immediately. Must not be called while holding a lock which the
+	/// thread that started the loop may need.
+	static void RunOnCallingThread(const Task& task);
+	/// Returns true if called by a worker thread within a parallel loop.
+	static bool IsInParallelLoop();
+
+	/// Returns the number of worker threads in the pool, zero if the pool is not running.
+	static int GetNumThreads();
+};
+
+} // namespace Rml
+#endif
@@ -0,0 +1,174 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "XMLParseRecording.h"
+#include "XMLParseTools.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include <algorithm>
+
+namespace Rml {
+
+// Parses RML the same way as XMLParser, but stores the handler calls instead of instancing any elements.
+class XMLParseRecording::Recorder final : public BaseXMLParser {
+public:
+	Recorder(Vector<Node>& nodes) : nodes(nodes)
+	{
+		RegisterCDATATag("script");
+
+		for (const String& name : Factory::GetStructuralDataViewAttributeNames())
+			RegisterInnerXMLAttribute(name);
+	}
+
+	void HandleElementStart(const String& name, const XMLAttributes& attributes) override
+	{
+		tags.push_back(StringUtilities::ToLower(name));
+		nodes.push_back(Node{Node::Type::ElementStart, XMLDataType::Text, name, attributes});
+	}
+
+	void HandleElementEnd(const String& name) override
+	{
+		// Mismatched tags are reported by the XML parser with the source location, which is not available while replaying.
+		if (tags.empty() || tags.back() != StringUtilities::ToLower(name))
+			valid = false;
+		if (!tags.empty())
+			tags.pop_back();
+
+		nodes.push_back(Node{Node::Type::ElementEnd, XMLDataType::Text, name, XMLAttributes()});
+	}
+
+	void HandleData(const String& data, XMLDataType type) override
+	{
+		nodes.push_back(Node{Node::Type::Data, type, data, XMLAttributes()});
+	}
+
+	bool IsValid() const { return valid; }
+
+private:
+	Vector<Node>& nodes;
+	StringList tags;
+	bool valid = true;
+};
+
+void XMLParseRecording::Instance(Element* parent, const String& in_rml)
+{
+	RMLUI_ASSERT(parent);
+
+	String rml;
+	if (SystemInterface* system_interface = GetSystemInterface())
+		system_interface->TranslateString(rml, in_rml);
+
+	Context* context = parent->GetContext();
+	const String base_tag = (context ? context->GetDocumentsBaseTag() : "body");
+
+	if (!recorded || rml != source || base_tag != source_base_tag)
+	{
+		replayable = Record(rml, base_tag);
+		recorded = true;
+		source = rml;
+		source_base_tag = base_tag;
+	}
+
+	if (!replayable)
+	{
+		Factory::InstanceElementText(parent, in_rml);
+		return;
+	}
+
+	RMLUI_ZoneScopedC(0xDC143C);
+
+	XMLParser parser(parent);
+	BaseXMLParser& handler = parser;
+
+	for (const Node& node : nodes)
+	{
+		switch (node.type)
+		{
+		case Node::Type::ElementStart: handler.HandleElementStart(node.value, node.attributes); break;
+		case Node::Type::ElementEnd: handler.HandleElementEnd(node.value); break;
+		case Node::Type::Data: handler.HandleData(node.value, node.data_type); break;
+		}
+	}
+}
+
+bool XMLParseRecording::Record(const String& rml, const String& base_tag)
+{
+	RMLUI_ZoneScoped;
+
+	nodes.clear();
+
+	// Only RML containing elements is run through the parser by the factory, anything else is cheap to instance directly.
+	if (std::all_of(rml.begin(), rml.end(), &StringUtilities::IsWhitespace))
+		return false;
+
+	bool parse_as_rml = false;
+	bool inside_brackets = false;
+	bool inside_string = false;
+	char previous = 0;
+	for (const char c : rml)
+	{
+		if (XMLParseTools::ParseDataBrackets(inside_brackets, inside_string, c, previous))
+			return false;
+
+		if (!inside_brackets && c == '<')
+			parse_as_rml = true;
+
+		previous = c;
+	}
+
+	if (!parse_as_rml)
+		return false;
+
+	auto stream = MakeUnique<StreamMemory>(rml.size() + 32);
+	const String open_tag = "<" + base_tag + ">";
+	const String close_tag = "</" + base_tag + ">";
+	stream->Write(open_tag.c_str(), open_tag.size());
+	stream->Write(rml);
+	stream->Write(close_tag.c_str(), close_tag.size());
+	stream->Seek(0, SEEK_SET);
+
+	Recorder recorder(nodes);
+	recorder.Parse(stream.get());
+
+	if (!recorder.IsValid())
+	{
+		nodes.clear();
+		return false;
+	}
+
+	return true;
+}
+
+} // namespace Rml
@@ -0,0 +1,79 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_XMLPARSERECORDING_H
+#define RMLUI_CORE_XMLPARSERECORDING_H
+
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	A recording of the handler calls made by the XML parser when instancing a piece of RML.
+
+	The RML is parsed once, then the recorded start, end and data calls can be replayed into the node handlers any
+	number of times to instance identical element trees, without running the XML parser on the source again.
+ */
+
+class XMLParseRecording {
+public:
+	/// Instances the given RML as children of the parent element, equivalent to Factory::InstanceElementText().
+	/// The RML is parsed and recorded on the first call, subsequent calls with the same RML replay the recording.
+	void Instance(Element* parent, const String& rml);
+
+private:
+	class Recorder;
+
+	struct Node {
+		enum class Type : uint8_t { ElementStart, ElementEnd, Data };
+		Type type;
+		XMLDataType data_type;
+		String value;
+		XMLAttributes attributes;
+	};
+
+	// Parses and records the RML, returns true if the recording can be replayed.
+	bool Record(const String& rml, const String& base_tag);
+
+	// The translated RML the recording was made from.
+	String source;
+	// The base tag which wraps the RML contents.
+	String source_base_tag;
+	// True once a recording has been made.
+	bool recorded = false;
+	// True if the source is parsed as RML and the nodes can be replayed.
+	bool replayable = false;
+
+	Vector<Node> nodes;
+};
+
+} // namespace Rml
+#endif
@@ -55,6 +55,9 @@ void ElementContextHook::OnRender()
 
 	// Render the debugging elements.
 	debugger->Render();
+
+	// The debugging elements follow the state of the inspected context, thus they need to be rendered on every frame.
+	DirtyRender();
 }
 
 }
@@ -33,11 +33,261 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../Core/WorkerPool.h"
 #include <cmath>
+#include <mutex>
+#include <utility>
 #include <rlottie.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define RMLUI_LOTTIE_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#define RMLUI_LOTTIE_NEON
+	#include <arm_neon.h>
+#endif
+
 namespace Rml {
 
+// The number of frames rendered ahead of the one currently displayed.
+static constexpr size_t num_prefetch_frames = 4;
+
+// Changes a pixel from pre-multiplied to post-multiplied alpha.
+static inline void UnpremultiplyPixel(byte* pixel)
+{
+	// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
+	const byte a = pixel[3];
+	if (a > 0 && a < 255)
+	{
+		for (size_t j = 0; j < 3; j++)
+			pixel[j] = byte((pixel[j] * 255) / a);
+	}
+}
+
+// Swizzles the channel order from rlottie's BGRA to RmlUi's RGBA, and changes pre-multiplied to post-multiplied alpha.
+static void ConvertPixels(byte* data, const size_t num_pixels)
+{
+	size_t i = 0;
+
+	// Most pixels of an animation are either fully opaque or fully transparent, and only need to be swizzled. Groups of
+	// pixels which contain any translucent pixels are additionally un-premultiplied one pixel at a time.
+#if defined(RMLUI_LOTTIE_SSE2)
+	const __m128i mask_alpha = _mm_set1_epi32(int(0xFF000000));
+	const __m128i mask_green_alpha = _mm_set1_epi32(int(0xFF00FF00));
+	const __m128i mask_low = _mm_set1_epi32(0xFF);
+	const __m128i zero = _mm_setzero_si128();
+
+	for (; i + 4 <= num_pixels; i += 4)
+	{
+		byte* pixels = data + 4 * i;
+		const __m128i bgra = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels));
+
+		const __m128i blue_to_red = _mm_slli_epi32(_mm_and_si128(bgra, mask_low), 16);
+		const __m128i red_to_blue = _mm_and_si128(_mm_srli_epi32(bgra, 16), mask_low);
+		const __m128i rgba = _mm_or_si128(_mm_and_si128(bgra, mask_green_alpha), _mm_or_si128(blue_to_red, red_to_blue));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pixels), rgba);
+
+		const __m128i alpha = _mm_and_si128(bgra, mask_alpha);
+		const __m128i alpha_trivial = _mm_or_si128(_mm_cmpeq_epi32(alpha, zero), _mm_cmpeq_epi32(alpha, mask_alpha));
+		if (_mm_movemask_epi8(alpha_trivial) != 0xFFFF)
+		{
+			for (size_t j = 0; j < 4; j++)
+				UnpremultiplyPixel(pixels + 4 * j);
+		}
+	}
+#elif defined(RMLUI_LOTTIE_NEON)
+	for (; i + 16 <= num_pixels; i += 16)
+	{
+		byte* pixels = data + 4 * i;
+		uint8x16x4_t channels = vld4q_u8(pixels);
+
+		const uint8x16_t blue = channels.val[0];
+		channels.val[0] = channels.val[2];
+		channels.val[2] = blue;
+		vst4q_u8(pixels, channels);
+
+		const uint8x16_t alpha = channels.val[3];
+		const uint8x16_t alpha_trivial = vorrq_u8(vceqq_u8(alpha, vdupq_n_u8(0)), vceqq_u8(alpha, vdupq_n_u8(255)));
+		const uint8x8_t alpha_trivial_halves = vand_u8(vget_low_u8(alpha_trivial), vget_high_u8(alpha_trivial));
+		if (vget_lane_u64(vreinterpret_u64_u8(alpha_trivial_halves), 0) != ~uint64_t(0))
+		{
+			for (size_t j = 0; j < 16; j++)
+				UnpremultiplyPixel(pixels + 4 * j);
+		}
+	}
+#endif
+
+	for (; i < num_pixels; i++)
+	{
+		byte* pixel = data + 4 * i;
+		std::swap(pixel[0], pixel[2]);
+		UnpremultiplyPixel(pixel);
+	}
+}
+
+struct ElementLottie::FrameQueue {
+	struct Frame {
+		size_t frame = size_t(-1);
+		Vector2i dimensions;
+		UniquePtr<const byte[]> data;
+	};
+
+	// Rendering may only be done by one thread at a time while holding the render mutex. Querying the animation's timing
+	// only reads from its immutable model, and is safe to do from the main thread without locking.
+	UniquePtr<rlottie::Animation> animation;
+	std::mutex render_mutex;
+
+	// All members below are protected by this mutex.
+	std::mutex mutex;
+	Frame frames[num_prefetch_frames];
+	size_t total_frames = 0;
+	// The frame most recently requested for display, prefetching starts from the frame after this one.
+	size_t current_frame = 0;
+	// The expected number of frames advanced between each displayed frame.
+	size_t frame_step = 1;
+	Vector2i dimensions;
+	bool task_running = false;
+	bool released = false;
+
+	// Renders the given frame and converts it to RmlUi's pixel format.
+	UniquePtr<const byte[]> RenderFrame(const size_t frame, const Vector2i frame_dimensions)
+	{
+		const size_t bytes_per_line = 4 * size_t(frame_dimensions.x);
+		byte* p_data = new byte[bytes_per_line * size_t(frame_dimensions.y)];
+
+		{
+			std::lock_guard<std::mutex> lock(render_mutex);
+			rlottie::Surface surface(reinterpret_cast<std::uint32_t*>(p_data), frame_dimensions.x, frame_dimensions.y, bytes_per_line);
+			animation->renderSync(frame, surface);
+		}
+
+		ConvertPixels(p_data, size_t(frame_dimensions.x) * size_t(frame_dimensions.y));
+
+		return UniquePtr<const byte[]>(p_data);
+	}
+
+	// Hands over the prefetched frame if available, otherwise returns null.
+	UniquePtr<const byte[]> TakeFrame(const size_t frame, const Vector2i frame_dimensions)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (Frame& entry : frames)
+		{
+			if (entry.data && entry.frame == frame && entry.dimensions == frame_dimensions)
+				return std::move(entry.data);
+		}
+		return nullptr;
+	}
+
+	// Sets the frame about to be displayed, and starts prefetching the frames following it unless already in progress.
+	static void RequestFrames(const SharedPtr<FrameQueue>& queue, const size_t frame, const Vector2i frame_dimensions)
+	{
+		size_t frame_to_prefetch = 0;
+		{
+			std::lock_guard<std::mutex> lock(queue->mutex);
+
+			// Keep the previous step when the animation wraps around.
+			if (frame > queue->current_frame)
+				queue->frame_step = Math::Min(frame - queue->current_frame, Math::Max(queue->total_frames / num_prefetch_frames, size_t(1)));
+
+			queue->current_frame = frame;
+			queue->dimensions = frame_dimensions;
+
+			if (queue->task_running || queue->released || !queue->FindFrameToPrefetch(frame_to_prefetch))
+				return;
+
+			queue->task_running = true;
+		}
+
+		WorkerPool::Submit([queue]() { queue->RunPrefetch(); });
+	}
+
+	// Stops any prefetching in progress after its current frame.
+	void Release()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		released = true;
+	}
+
+private:
+	// Renders frames until all the upcoming frames are available. Called on a worker thread.
+	void RunPrefetch()
+	{
+		while (true)
+		{
+			size_t frame = 0;
+			Vector2i frame_dimensions;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (released || !FindFrameToPrefetch(frame))
+				{
+					task_running = false;
+					return;
+				}
+				frame_dimensions = dimensions;
+			}
+
+			UniquePtr<const byte[]> data = RenderFrame(frame, frame_dimensions);
+
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				StoreFrame(frame, frame_dimensions, std::move(data));
+			}
+		}
+	}
+
+	bool IsUpcomingFrame(const size_t frame) const
+	{
+		for (size_t i = 1; i <= num_prefetch_frames; i++)
+		{
+			if ((current_frame + i * frame_step) % total_frames == frame)
+				return true;
+		}
+		return false;
+	}
+
+	// Finds the nearest upcoming frame which has not yet been rendered at the current dimensions.
+	bool FindFrameToPrefetch(size_t& out_frame) const
+	{
+		if (total_frames == 0 || dimensions.x <= 0 || dimensions.y <= 0)
+			return false;
+
+		for (size_t i = 1; i <= num_prefetch_frames; i++)
+		{
+			const size_t frame = (current_frame + i * frame_step) % total_frames;
+
+			bool available = false;
+			for (const Frame& entry : frames)
+				available |= (entry.data && entry.frame == frame && entry.dimensions == dimensions);
+
+			if (!available)
+			{
+				out_frame = frame;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Stores the frame in a slot which is empty or no longer upcoming, or drops it if it is itself no longer needed.
+	void StoreFrame(const size_t frame, const Vector2i frame_dimensions, UniquePtr<const byte[]> data)
+	{
+		if (frame_dimensions != dimensions || !IsUpcomingFrame(frame))
+			return;
+
+		for (Frame& entry : frames)
+		{
+			if (!entry.data || entry.dimensions != dimensions || !IsUpcomingFrame(entry.frame))
+			{
+				entry.frame = frame;
+				entry.dimensions = frame_dimensions;
+				entry.data = std::move(data);
+				return;
+			}
+		}
+	}
+};
+
 
 ElementLottie::ElementLottie(const String& tag) : Element(tag), geometry(this)
 {
@@ -45,12 +295,15 @@ ElementLottie::ElementLottie(const String& tag) : Element(tag), geometry(this)
 
 ElementLottie::~ElementLottie()
 {
+	if (frame_queue)
+		frame_queue->Release();
 }
 
 bool ElementLottie::GetIntrinsicDimensions(Vector2f& dimensions, float& ratio)
 {
+	// Animations are loaded through the file interface, always do so on the thread updating the context.
 	if (animation_dirty)
-		LoadAnimation();
+		WorkerPool::RunOnCallingThread([this]() { LoadAnimation(); });
 
 	dimensions = intrinsic_dimensions;
 	if (dimensions.y > 0)
@@ -61,13 +314,16 @@ bool ElementLottie::GetIntrinsicDimensions(Vector2f& dimensions, float& ratio)
 
 void ElementLottie::OnRender()
 {
-	if (animation)
+	if (frame_queue)
 	{
 		if (geometry_dirty)
 			GenerateGeometry();
 
 		UpdateTexture();
 		geometry.Render(GetAbsoluteOffset(Box::CONTENT).Round());
+
+		// The animation advances on every frame, so make sure we are rendered again.
+		DirtyRender();
 	}
 }
 
@@ -115,8 +371,8 @@ void ElementLottie::GenerateGeometry()
 
 	const ComputedValues& computed = GetComputedValues();
 
-	const float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
+	const float opacity = computed.inherited->opacity;
+	Colourb quad_colour = computed.rare->image_color;
 	quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
 
 	const Vector2f render_dimensions_f = GetBox().GetSize(Box::CONTENT).Round();
@@ -132,7 +388,11 @@ bool ElementLottie::LoadAnimation()
 	animation_dirty = false;
 	intrinsic_dimensions = Vector2f{};
 	geometry.SetTexture(nullptr);
-	animation.reset();
+	if (frame_queue)
+		frame_queue->Release();
+	frame_queue.reset();
+	prefetched_frame_data.reset();
+	texture_dimensions = Vector2i(0, 0);
 	prev_animation_frame = size_t(-1);
 	time_animation_start = -1;
 
@@ -159,7 +419,7 @@ bool ElementLottie::LoadAnimation()
 		return false;
 	}
 
-	animation = rlottie::Animation::loadFromData(std::move(json_data), path, directory);
+	UniquePtr<rlottie::Animation> animation = rlottie::Animation::loadFromData(std::move(json_data), path, directory);
 
 	if (!animation)
 	{
@@ -169,6 +429,10 @@ bool ElementLottie::LoadAnimation()
 
 	size_t width = 0, height = 0;
 	animation->size(width, height);
+
+	frame_queue = MakeShared<FrameQueue>();
+	frame_queue->total_frames = animation->totalFrame();
+	frame_queue->animation = std::move(animation);
 	intrinsic_dimensions.x = float(width);
 	intrinsic_dimensions.y = float(height);
 
@@ -177,9 +441,10 @@ bool ElementLottie::LoadAnimation()
 
 void ElementLottie::UpdateTexture()
 {
-	if (!animation)
+	if (!frame_queue)
 		return;
 
+	rlottie::Animation* animation = frame_queue->animation.get();
 	const double t = GetSystemInterface()->GetElapsedTime();
 
 	if (time_animation_start < 0.0)
@@ -198,37 +463,36 @@ void ElementLottie::UpdateTexture()
 		return;
 	}
 
-	// Callback for generating texture.
-	auto p_callback = [this, next_frame](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
-		RMLUI_ASSERT(animation);
-
-		const size_t bytes_per_line = 4 * render_dimensions.x;
-		const size_t total_bytes = bytes_per_line * render_dimensions.y;
-
-		byte* p_data = new byte[total_bytes];
+	UniquePtr<const byte[]> frame_data = frame_queue->TakeFrame(next_frame, render_dimensions);
+	FrameQueue::RequestFrames(frame_queue, next_frame, render_dimensions);
 
-		rlottie::Surface surface(reinterpret_cast<std::uint32_t*>(p_data), render_dimensions.x, render_dimensions.y, bytes_per_line);
-		animation->renderSync(next_frame, surface);
-
-		// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA, and change pre-multiplied to post-multiplied alpha.
-		for (size_t i = 0; i < total_bytes; i += 4)
+	if (!frame_data)
+	{
+		// Keep displaying the previous frame while the worker catches up, only render synchronously when we have nothing
+		// to display at the current size.
+		if (texture_dimensions == render_dimensions && prev_animation_frame != size_t(-1))
 		{
-			// Swap the RB order for correct color channels.
-			std::swap(p_data[i], p_data[i + 2]);
+			texture_size_dirty = false;
+			return;
+		}
+		frame_data = frame_queue->RenderFrame(next_frame, render_dimensions);
+	}
 
-			const byte a = p_data[i + 3];
+	prefetched_frame_data = std::move(frame_data);
+	texture_dimensions = render_dimensions;
 
-			// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
-			// Here, we un-premultiply the colors.
-			if (a > 0 && a < 255)
-			{
-				for (size_t j = 0; j < 3; j++)
-					p_data[i + j] = (p_data[i + j] * 255) / a;
-			}
-		}
+	// Callback for generating texture.
+	const Vector2i frame_dimensions = render_dimensions;
+	auto p_callback = [this, next_frame, frame_dimensions](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
+		RMLUI_ASSERT(frame_queue);
+
+		// The frame is rendered again if the texture is reloaded after the prefetched data has been consumed.
+		if (prefetched_frame_data)
+			data = std::move(prefetched_frame_data);
+		else
+			data = frame_queue->RenderFrame(next_frame, frame_dimensions);
 
-		data.reset(p_data);
-		dimensions = render_dimensions;
+		dimensions = frame_dimensions;
 
 		return true;
 	};
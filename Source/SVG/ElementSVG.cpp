@@ -34,8 +34,8 @@
 #include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "SVGCache.h"
 #include <cmath>
-#include <lunasvg.h>
 
 namespace Rml {
 
@@ -73,7 +73,10 @@ void ElementSVG::OnRender()
 			GenerateGeometry();
 
 		UpdateTexture();
-		geometry.Render(GetAbsoluteOffset(Box::CONTENT));
+
+		// Nothing is rendered until the first bitmap has been rasterised.
+		if (bitmap)
+			geometry.Render(GetAbsoluteOffset(Box::CONTENT));
 	}
 }
 
@@ -123,8 +126,8 @@ void ElementSVG::GenerateGeometry()
 
 	const ComputedValues& computed = GetComputedValues();
 
-	const float opacity = computed.opacity;
-	Colourb quad_colour = computed.image_color;
+	const float opacity = computed.inherited->opacity;
+	Colourb quad_colour = computed.rare->image_color;
 	quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
 
 	const Vector2f render_dimensions_f = GetBox().GetSize(Box::CONTENT).Round();
@@ -142,6 +145,9 @@ bool ElementSVG::LoadSource()
 	intrinsic_dimensions = Vector2f{};
 	geometry.SetTexture(nullptr);
 	svg_document.reset();
+	bitmap.reset();
+	pending_bitmap.reset();
+	source_path.clear();
 
 	const String attribute_src = GetAttribute<String>("src", "");
 
@@ -158,53 +164,47 @@ bool ElementSVG::LoadSource()
 		GetSystemInterface()->JoinPath(directory, document_source_url, "");
 	}
 
-	String svg_data;
-
-	if (path.empty() || !GetFileInterface()->LoadFile(path, svg_data))
-	{
-		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG file %s", path.c_str());
-		return false;
-	}
-
-	// We use a reset-release approach here in case clients use a non-std unique_ptr (lunasvg uses std::unique_ptr)
-	svg_document.reset(lunasvg::Document::loadFromData(svg_data).release());
+	// Documents are shared between all elements using the same source file.
+	svg_document = SVG::SVGCache::GetDocument(path);
 
 	if (!svg_document)
-	{
-		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG data from file %s", path.c_str());
 		return false;
-	}
 
-	intrinsic_dimensions.x = Math::Max(float(svg_document->width()), 1.0f);
-	intrinsic_dimensions.y = Math::Max(float(svg_document->height()), 1.0f);
+	source_path = path;
+	intrinsic_dimensions = svg_document->intrinsic_dimensions;
+	texture_size_dirty = true;
 
 	return true;
 }
 
 void ElementSVG::UpdateTexture()
 {
-	if (!svg_document || !texture_size_dirty)
+	if (!svg_document)
 		return;
 
-	// Callback for generating texture.
-	auto p_callback = [this](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
-		RMLUI_ASSERT(svg_document);
-
-		const size_t total_bytes = 4 * render_dimensions.x * render_dimensions.y;
-
-		lunasvg::Bitmap bitmap = svg_document->renderToBitmap(render_dimensions.x, render_dimensions.y);
-		bitmap.convertToRGBA();
-
-		data.reset(new byte[total_bytes]);
-		memcpy((void*)data.get(), bitmap.data(), total_bytes);
-		dimensions = render_dimensions;
-
-		return true;
-	};
+	if (texture_size_dirty)
+	{
+		texture_size_dirty = false;
+
+		// Keep rendering the current bitmap until the bitmap for the new size has been rasterised in the background.
+		SharedPtr<SVG::SVGBitmap> new_bitmap = SVG::SVGCache::GetBitmap(source_path, svg_document, render_dimensions);
+		if (new_bitmap == bitmap)
+		{
+			pending_bitmap.reset();
+		}
+		else
+		{
+			pending_bitmap = std::move(new_bitmap);
+			if (!pending_bitmap->ready)
+				pending_bitmap->observers.push_back(GetObserverPtr());
+		}
+	}
 
-	texture.Set("svg", p_callback);
-	geometry.SetTexture(&texture);
-	texture_size_dirty = false;
+	if (pending_bitmap && pending_bitmap->ready)
+	{
+		bitmap = std::move(pending_bitmap);
+		geometry.SetTexture(&bitmap->texture);
+	}
 }
 
 } // namespace Rml
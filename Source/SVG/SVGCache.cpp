@@ -0,0 +1,202 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "SVGCache.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../Core/WorkerPool.h"
+#include <lunasvg.h>
+#include <string.h>
+
+namespace Rml {
+namespace SVG {
+
+SVGDocument::SVGDocument() {}
+
+SVGDocument::~SVGDocument() {}
+
+// The cache only holds weak references, the documents and bitmaps are released when no longer used by any element.
+static UnorderedMap<String, WeakPtr<SVGDocument>> documents;
+static UnorderedMap<String, WeakPtr<SVGBitmap>> bitmaps;
+// The number of bitmap entries at which expired entries are removed from the cache.
+static size_t bitmaps_cleanup_size = 64;
+
+// Rounds the size up to the size bucket it belongs to. The buckets grow with the size, so that an element being resized only
+// occasionally needs to be rasterised again, while the bitmap is scaled by at most a few percent when rendered.
+static int QuantiseSize(const int size)
+{
+	int step = 1;
+	while (step * 32 < size)
+		step *= 2;
+
+	return ((size + step - 1) / step) * step;
+}
+
+// Rasterises the document into a new RGBA buffer, may be called from any thread.
+static UniquePtr<const byte[]> RenderDocument(SVGDocument& document, const Vector2i dimensions)
+{
+	std::lock_guard<std::mutex> lock(document.render_mutex);
+
+	const size_t bytes_per_line = 4 * size_t(dimensions.x);
+	byte* data = new byte[bytes_per_line * size_t(dimensions.y)]();
+
+	// Documents without an intrinsic size cannot be rendered by lunasvg, they are left transparent.
+	lunasvg::Bitmap bitmap = document.document->renderToBitmap(dimensions.x, dimensions.y);
+	if (bitmap.valid() && bitmap.width() == (std::uint32_t)dimensions.x && bitmap.height() == (std::uint32_t)dimensions.y)
+	{
+		bitmap.convertToRGBA();
+		for (int y = 0; y < dimensions.y; y++)
+			memcpy(data + y * bytes_per_line, bitmap.data() + y * size_t(bitmap.stride()), bytes_per_line);
+	}
+
+	return UniquePtr<const byte[]>(data);
+}
+
+// Makes the bitmap available to its texture, and notifies any waiting elements.
+static void PublishBitmap(SVGBitmap& bitmap)
+{
+	SVGBitmap* bitmap_ptr = &bitmap;
+
+	// The rasterised data is handed over on the first load. If the texture needs to be loaded again, such as after the render
+	// interface released its textures, it is instead rasterised on the main thread.
+	bitmap.texture.Set("svg", [bitmap_ptr](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
+		if (bitmap_ptr->data)
+			data = std::move(bitmap_ptr->data);
+		else
+			data = RenderDocument(*bitmap_ptr->document, bitmap_ptr->dimensions);
+
+		dimensions = bitmap_ptr->dimensions;
+		return true;
+	});
+
+	bitmap.ready = true;
+
+	for (ObserverPtr<Element>& observer : bitmap.observers)
+	{
+		if (Element* element = observer.get())
+			element->DirtyRender();
+	}
+	bitmap.observers.clear();
+}
+
+SharedPtr<SVGDocument> SVGCache::GetDocument(const String& path)
+{
+	// Documents are loaded during layout, which may run on the worker threads when documents are updated in parallel.
+	if (WorkerPool::IsInParallelLoop())
+	{
+		SharedPtr<SVGDocument> document;
+		WorkerPool::RunOnCallingThread([&]() { document = GetDocument(path); });
+		return document;
+	}
+
+	auto it = documents.find(path);
+	if (it != documents.end())
+	{
+		if (SharedPtr<SVGDocument> document = it->second.lock())
+			return document;
+	}
+
+	String svg_data;
+
+	if (path.empty() || !GetFileInterface()->LoadFile(path, svg_data))
+	{
+		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG file %s", path.c_str());
+		return nullptr;
+	}
+
+	SharedPtr<SVGDocument> document = MakeShared<SVGDocument>();
+
+	// We use a reset-release approach here in case clients use a non-std unique_ptr (lunasvg uses std::unique_ptr)
+	document->document.reset(lunasvg::Document::loadFromData(svg_data).release());
+
+	if (!document->document)
+	{
+		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG data from file %s", path.c_str());
+		return nullptr;
+	}
+
+	document->intrinsic_dimensions.x = Math::Max(float(document->document->width()), 1.0f);
+	document->intrinsic_dimensions.y = Math::Max(float(document->document->height()), 1.0f);
+
+	documents[path] = document;
+
+	return document;
+}
+
+SharedPtr<SVGBitmap> SVGCache::GetBitmap(const String& path, const SharedPtr<SVGDocument>& document, Vector2i dimensions)
+{
+	RMLUI_ASSERT(document);
+
+	dimensions = Vector2i(QuantiseSize(Math::Max(dimensions.x, 1)), QuantiseSize(Math::Max(dimensions.y, 1)));
+
+	const String key = CreateString(path.size() + 32, "%s|%dx%d", path.c_str(), dimensions.x, dimensions.y);
+
+	auto it = bitmaps.find(key);
+	if (it != bitmaps.end())
+	{
+		SharedPtr<SVGBitmap> bitmap = it->second.lock();
+		if (bitmap && bitmap->document == document)
+			return bitmap;
+	}
+
+	if (bitmaps.size() >= bitmaps_cleanup_size)
+	{
+		for (auto it_bitmap = bitmaps.begin(); it_bitmap != bitmaps.end();)
+		{
+			if (it_bitmap->second.expired())
+				it_bitmap = bitmaps.erase(it_bitmap);
+			else
+				++it_bitmap;
+		}
+		bitmaps_cleanup_size = Math::Max(bitmaps_cleanup_size, 2 * bitmaps.size());
+	}
+
+	SharedPtr<SVGBitmap> bitmap = MakeShared<SVGBitmap>();
+	bitmap->document = document;
+	bitmap->dimensions = dimensions;
+	bitmaps[key] = bitmap;
+
+	WorkerPool::Submit([bitmap]() { bitmap->data = RenderDocument(*bitmap->document, bitmap->dimensions); },
+		[bitmap]() { PublishBitmap(*bitmap); });
+
+	return bitmap;
+}
+
+void SVGCache::Shutdown()
+{
+	documents.clear();
+	bitmaps.clear();
+	bitmaps_cleanup_size = 64;
+}
+
+} // namespace SVG
+} // namespace Rml
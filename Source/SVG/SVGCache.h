@@ -0,0 +1,94 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_SVG_SVG_CACHE_H
+#define RMLUI_SVG_SVG_CACHE_H
+
+#include "../../Include/RmlUi/Core/ObserverPtr.h"
+#include "../../Include/RmlUi/Core/Texture.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
+
+namespace lunasvg { class Document; }
+
+namespace Rml {
+
+class Element;
+
+namespace SVG {
+
+/**
+	A parsed SVG document, shared by all elements displaying the same source file.
+ */
+struct SVGDocument : NonCopyMoveable {
+	UniquePtr<lunasvg::Document> document;
+	Vector2f intrinsic_dimensions;
+
+	// Serialises the rasterisation of the document, which may happen on the main thread and on worker threads.
+	std::mutex render_mutex;
+
+	SVGDocument();
+	~SVGDocument();
+};
+
+/**
+	An SVG document rasterised to a texture, shared by all elements displaying the same source within the same size bucket.
+
+	The bitmap is rasterised on the worker pool, its texture must not be used until the bitmap is ready.
+ */
+struct SVGBitmap : NonCopyMoveable {
+	SharedPtr<SVGDocument> document;
+	Vector2i dimensions;
+
+	bool ready = false;
+	Texture texture;
+
+	// The rasterised data, handed over to the texture when it is first loaded.
+	UniquePtr<const byte[]> data;
+	// Elements waiting for the bitmap, they are dirtied for rendering once it is ready.
+	Vector<ObserverPtr<Element>> observers;
+};
+
+namespace SVGCache {
+
+	// Returns the document loaded from the given path, loading it if necessary. Returns nullptr on failure.
+	SharedPtr<SVGDocument> GetDocument(const String& path);
+
+	// Returns the document at the given path rasterised to the size bucket containing the given dimensions. If the bitmap is not
+	// already available, its rasterisation is started on the worker pool.
+	SharedPtr<SVGBitmap> GetBitmap(const String& path, const SharedPtr<SVGDocument>& document, Vector2i dimensions);
+
+	// Releases the cache's references to all documents and bitmaps.
+	void Shutdown();
+
+} // namespace SVGCache
+} // namespace SVG
+} // namespace Rml
+
+#endif
@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/Plugin.h"
+#include "SVGCache.h"
 
 namespace Rml {
 namespace SVG {
@@ -51,6 +52,7 @@ public:
 
 	void OnShutdown() override
 	{
+		SVGCache::Shutdown();
 		delete this;
 	}
 
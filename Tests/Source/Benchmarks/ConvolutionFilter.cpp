@@ -0,0 +1,119 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../../Source/Core/ConvolutionFilter.cpp"
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace Rml;
+using namespace ankerl;
+
+TEST_CASE("convolution_filter")
+{
+	// A glyph-sized disc, blurred with a Gaussian kernel as done by a 10px glow effect.
+	constexpr int glyph_size = 32;
+	constexpr int radius = 10;
+
+	const Vector2i source_dimensions(glyph_size);
+	const Vector2i destination_dimensions = source_dimensions + Vector2i(2 * radius);
+	const Vector2i kernel_size(2 * radius + 1);
+
+	Vector<byte> source(glyph_size * glyph_size);
+	for (int y = 0; y < glyph_size; y++)
+	{
+		for (int x = 0; x < glyph_size; x++)
+		{
+			const float distance = Vector2f(float(x) - 0.5f * glyph_size, float(y) - 0.5f * glyph_size).Magnitude();
+			source[y * glyph_size + x] = byte(Math::Clamp(0.5f * glyph_size - distance, 0.f, 1.f) * 255.f);
+		}
+	}
+
+	Vector<float> kernel_1d(kernel_size.x);
+	float sum_weight = 0.f;
+	for (int i = 0; i < kernel_size.x; i++)
+	{
+		const float x = float(i - radius);
+		kernel_1d[i] = Math::Exp(-x * x / (2.f * (radius / 3.f) * (radius / 3.f)));
+		sum_weight += kernel_1d[i];
+	}
+	for (float& weight : kernel_1d)
+		weight /= sum_weight;
+
+	Vector<float> kernel_2d(kernel_size.x * kernel_size.y);
+	for (int y = 0; y < kernel_size.y; y++)
+		for (int x = 0; x < kernel_size.x; x++)
+			kernel_2d[y * kernel_size.x + x] = kernel_1d[y] * kernel_1d[x];
+
+	const int stride = destination_dimensions.x * 4;
+	Vector<byte> reference(stride * destination_dimensions.y);
+	Vector<byte> destination(stride * destination_dimensions.y);
+	Vector<byte> intermediate(destination_dimensions.x * destination_dimensions.y);
+
+	nanobench::Bench bench;
+	bench.title("Convolution filter");
+	bench.relative(true);
+
+	bench.run("2D kernel (reference)", [&] {
+		RunReference(reference.data(), destination_dimensions, stride, ColorFormat::RGBA8, source.data(), source_dimensions, Vector2i(radius),
+			ColorFormat::A8, kernel_2d.data(), kernel_size, FilterOperation::Sum);
+	});
+
+	bench.run("1D kernels (reference)", [&] {
+		RunReference(intermediate.data(), destination_dimensions, destination_dimensions.x, ColorFormat::A8, source.data(), source_dimensions,
+			Vector2i(radius), ColorFormat::A8, kernel_1d.data(), Vector2i(kernel_size.x, 1), FilterOperation::Sum);
+		RunReference(destination.data(), destination_dimensions, stride, ColorFormat::RGBA8, intermediate.data(), destination_dimensions,
+			Vector2i(0), ColorFormat::A8, kernel_1d.data(), Vector2i(1, kernel_size.y), FilterOperation::Sum);
+	});
+
+	const float one = 1.f;
+	auto CheckSeparableResult = [&]() {
+		for (size_t i = 3; i < reference.size(); i += 4)
+			REQUIRE(Math::AbsoluteValue(int(destination[i]) - int(reference[i])) <= 1);
+	};
+
+	bench.run("Separable (scalar)", [&] {
+		RunSeparable(destination.data(), destination_dimensions, stride, ColorFormat::RGBA8, source.data(), source_dimensions, Vector2i(radius),
+			ColorFormat::A8, kernel_1d.data(), kernel_1d.data(), kernel_size, false);
+	});
+	CheckSeparableResult();
+
+	bench.run("Separable (vectorised)", [&] {
+		RunSeparable(destination.data(), destination_dimensions, stride, ColorFormat::RGBA8, source.data(), source_dimensions, Vector2i(radius),
+			ColorFormat::A8, kernel_1d.data(), kernel_1d.data(), kernel_size, true);
+	});
+	CheckSeparableResult();
+
+	bench.run("1D kernels (vectorised)", [&] {
+		RunSeparable(intermediate.data(), destination_dimensions, destination_dimensions.x, ColorFormat::A8, source.data(), source_dimensions,
+			Vector2i(radius), ColorFormat::A8, kernel_1d.data(), &one, Vector2i(kernel_size.x, 1), true);
+		RunSeparable(destination.data(), destination_dimensions, stride, ColorFormat::RGBA8, intermediate.data(), destination_dimensions,
+			Vector2i(0), ColorFormat::A8, &one, kernel_1d.data(), Vector2i(1, kernel_size.y), true);
+	});
+	CheckSeparableResult();
+}
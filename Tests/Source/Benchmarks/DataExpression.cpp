@@ -91,6 +91,20 @@ TEST_CASE("data_expressions")
 		"Complex (execute)"
 	);
 
+	{
+		// Runs through the data expression, which resolves the top-level variables once and reuses them.
+		DataExpression expression("radius < 10 ? radius*radius*3.14 + 2*2 : color_value");
+		REQUIRE(expression.Parse(interface, false));
+
+		Variant value;
+		bool result = true;
+		bench.run("Variable slots (execute)", [&] {
+			result &= expression.Run(interface, value);
+		});
+
+		REQUIRE(result);
+	}
+
 	auto bench_assignment = [&](const String& expression, const char* parse_name, const char* execute_name) {
 		DataParser parser(expression, interface); 
 		
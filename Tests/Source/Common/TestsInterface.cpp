@@ -53,6 +53,13 @@ bool TestsSystemInterface::LogMessage(Rml::Log::Type type, const Rml::String& me
 	return result;
 }
 
+double TestsSystemInterface::GetElapsedTime()
+{
+	if (fixed_time >= 0.0)
+		return fixed_time;
+	return ShellSystemInterface::GetElapsedTime();
+}
+
 void TestsSystemInterface::SetNumExpectedWarnings(int in_num_expected_warnings)
 {
 	if (num_expected_warnings > 0)
@@ -72,6 +79,11 @@ void TestsSystemInterface::SetNumExpectedWarnings(int in_num_expected_warnings)
 	num_expected_warnings = in_num_expected_warnings;
 }
 
+void TestsSystemInterface::SetTime(double time)
+{
+	fixed_time = time;
+}
+
 void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, const Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
 {
 	counters.render_calls += 1;
@@ -37,12 +37,18 @@ class TestsSystemInterface : public ShellSystemInterface
 {
 public:
 	bool LogMessage(Rml::Log::Type type, const Rml::String& message) override;
+	double GetElapsedTime() override;
 
 	// Checks and clears previously logged messages, then sets the number of expected
 	// warnings and errors until the next call.
 	void SetNumExpectedWarnings(int num_expected_warnings);
 
+	// Reports the given time instead of the shell's clock, or uses the clock again if negative.
+	void SetTime(double time);
+
 private:
+	double fixed_time = -1.0;
+
 	int num_logged_warnings = 0;
 	int num_expected_warnings = 0;
 
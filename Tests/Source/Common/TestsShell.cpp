@@ -155,6 +155,7 @@ void TestsShell::ShutdownShell()
 		(void)num_documents_begin;
 
 		tests_system_interface.SetNumExpectedWarnings(0);
+		tests_system_interface.SetTime(-1.0);
 
 		Rml::Shutdown();
 
@@ -174,6 +175,11 @@ void TestsShell::SetNumExpectedWarnings(int num_warnings)
 	tests_system_interface.SetNumExpectedWarnings(num_warnings);
 }
 
+void TestsShell::SetTime(double time)
+{
+	tests_system_interface.SetTime(time);
+}
+
 Rml::String TestsShell::GetRenderStats()
 {
 	Rml::String result;
@@ -51,6 +51,10 @@ namespace TestsShell {
 	// or until 'ShutdownShell()'.
 	void SetNumExpectedWarnings(int num_warnings);
 
+	// Set the time reported to RmlUi in seconds, until the next call to this function or until 'ShutdownShell()'.
+	// A negative value reports the real time again.
+	void SetTime(double time);
+
 	// Stats only available for the dummy renderer.
 	Rml::String GetRenderStats();
 }
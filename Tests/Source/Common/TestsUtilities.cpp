@@ -0,0 +1,55 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TestsUtilities.h"
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/StyleSheetSpecification.h>
+#include <doctest.h>
+
+void TestsUtilities::CompareElements(Rml::Element* a, Rml::Element* b)
+{
+	using namespace Rml;
+
+	REQUIRE(a->GetTagName() == b->GetTagName());
+	CHECK(a->GetId() == b->GetId());
+	CHECK(a->GetBox() == b->GetBox());
+	CHECK(a->GetAbsoluteOffset() == b->GetAbsoluteOffset());
+
+	for (PropertyId id : StyleSheetSpecification::GetRegisteredProperties())
+	{
+		const Property* property_a = a->GetProperty(id);
+		const Property* property_b = b->GetProperty(id);
+		REQUIRE(property_a);
+		REQUIRE(property_b);
+		CHECK_MESSAGE(property_a->ToString() == property_b->ToString(), StyleSheetSpecification::GetPropertyName(id));
+	}
+
+	REQUIRE(a->GetNumChildren(true) == b->GetNumChildren(true));
+	for (int i = 0; i < a->GetNumChildren(true); i++)
+		CompareElements(a->GetChild(i), b->GetChild(i));
+}
@@ -0,0 +1,125 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../../Source/Core/ConvolutionFilter.cpp"
+
+#include <doctest.h>
+
+using namespace Rml;
+
+TEST_CASE("convolution_filter")
+{
+	constexpr int size = 13;
+	constexpr int radius = 3;
+	constexpr int kernel_length = 2 * radius + 1;
+
+	Vector<byte> source(size * size);
+	for (int y = 0; y < size; y++)
+		for (int x = 0; x < size; x++)
+			source[y * size + x] = byte((x * 37 + y * 91) % 256);
+
+	const Vector2i source_dimensions(size);
+	const Vector2i destination_dimensions = source_dimensions + Vector2i(2 * radius);
+	const int stride = destination_dimensions.x * 4;
+
+	const float weights[kernel_length] = {0.05f, 0.1f, 0.2f, 0.3f, 0.2f, 0.1f, 0.05f};
+
+	// Sets up the filter with the given kernel, and returns the results of the filter and the reference implementation.
+	auto RunFilter = [&](const Vector<float>& kernel, Vector2i kernel_radii) {
+		const Vector2i kernel_size = kernel_radii * 2 + Vector2i(1);
+		ConvolutionFilter filter;
+		REQUIRE(filter.Initialise(kernel_radii, FilterOperation::Sum));
+		for (int y = 0; y < kernel_size.y; y++)
+			for (int x = 0; x < kernel_size.x; x++)
+				filter[y][x] = kernel[y * kernel_size.x + x];
+
+		Vector<byte> result(stride * destination_dimensions.y);
+		filter.Run(result.data(), destination_dimensions, stride, ColorFormat::RGBA8, source.data(), source_dimensions, Vector2i(radius),
+			ColorFormat::A8);
+
+		Vector<byte> reference(stride * destination_dimensions.y);
+		RunReference(reference.data(), destination_dimensions, stride, ColorFormat::RGBA8, source.data(), source_dimensions, Vector2i(radius),
+			ColorFormat::A8, kernel.data(), kernel_size, FilterOperation::Sum);
+
+		return std::make_pair(result, reference);
+	};
+
+	SUBCASE("1D")
+	{
+		// One-dimensional kernels give exactly the same results as the reference implementation.
+		const Vector<float> kernel(weights, weights + kernel_length);
+
+		auto horizontal = RunFilter(kernel, Vector2i(radius, 0));
+		CHECK(horizontal.first == horizontal.second);
+
+		auto vertical = RunFilter(kernel, Vector2i(0, radius));
+		CHECK(vertical.first == vertical.second);
+	}
+
+	SUBCASE("Separable")
+	{
+		Vector<float> kernel(kernel_length * kernel_length);
+		for (int y = 0; y < kernel_length; y++)
+			for (int x = 0; x < kernel_length; x++)
+				kernel[y * kernel_length + x] = weights[y] * weights[x];
+
+		float row_kernel[kernel_length], column_kernel[kernel_length];
+		CHECK(SeparateKernel(kernel.data(), Vector2i(kernel_length), row_kernel, column_kernel));
+
+		// The separable passes sum in a different order, which may round differently.
+		auto result = RunFilter(kernel, Vector2i(radius));
+		for (size_t i = 0; i < result.first.size(); i++)
+			CHECK(std::abs(int(result.first[i]) - int(result.second[i])) <= 1);
+
+		// Scalar and vectorised passes give the same results.
+		Vector<byte> scalar(stride * destination_dimensions.y);
+		Vector<byte> vectorised(stride * destination_dimensions.y);
+		RunSeparable(scalar.data(), destination_dimensions, stride, ColorFormat::RGBA8, source.data(), source_dimensions, Vector2i(radius),
+			ColorFormat::A8, row_kernel, column_kernel, Vector2i(kernel_length), false);
+		RunSeparable(vectorised.data(), destination_dimensions, stride, ColorFormat::RGBA8, source.data(), source_dimensions, Vector2i(radius),
+			ColorFormat::A8, row_kernel, column_kernel, Vector2i(kernel_length), true);
+		CHECK(scalar == vectorised);
+	}
+
+	SUBCASE("Not separable")
+	{
+		// A cross-shaped kernel can not be separated, it falls back to the reference implementation.
+		Vector<float> kernel(kernel_length * kernel_length, 0.f);
+		for (int i = 0; i < kernel_length; i++)
+		{
+			kernel[radius * kernel_length + i] = weights[i];
+			kernel[i * kernel_length + radius] = weights[i];
+		}
+
+		float row_kernel[kernel_length], column_kernel[kernel_length];
+		CHECK(!SeparateKernel(kernel.data(), Vector2i(kernel_length), row_kernel, column_kernel));
+
+		auto result = RunFilter(kernel, Vector2i(radius));
+		CHECK(result.first == result.second);
+	}
+}
@@ -449,4 +449,396 @@ TEST_CASE("databinding.inside_string")
 	document->Close();
 
 	TestsShell::ShutdownShell();
-}
\ No newline at end of file
+}
+
+static const String for_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div data-model="for">
+<p data-for="row : rows" class="row"><span data-if="row.size > 1">{{ it_index }}</span><em data-for="row">{{ it }}</em><strong data-class-last="it_index == rows.size - 1">x</strong></p>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.for")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<Vector<int>> rows;
+
+	DataModelConstructor constructor = context->CreateDataModel("for");
+	REQUIRE(constructor);
+	REQUIRE(constructor.RegisterArray<Vector<int>>());
+	REQUIRE(constructor.RegisterArray<Vector<Vector<int>>>());
+	REQUIRE(constructor.Bind("rows", &rows));
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(for_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// Describes the generated rows as: [index if shown]|items|last
+	auto GetRows = [&]() {
+		context->Update();
+		String result;
+		ElementList row_elements;
+		document->QuerySelectorAll(row_elements, ".row");
+		for (Element* row : row_elements)
+		{
+			// Skip the element holding the data-for view itself.
+			if (row->HasAttribute("data-for"))
+				continue;
+
+			Element* span = row->QuerySelector("span");
+			if (span && span->GetComputedValues().display != Style::Display::None)
+				result += span->GetInnerRML();
+			result += "|";
+
+			ElementList items;
+			row->QuerySelectorAll(items, "em");
+			for (Element* item : items)
+			{
+				if (!item->HasAttribute("data-for"))
+					result += item->GetInnerRML();
+			}
+
+			Element* strong = row->QuerySelector("strong");
+			result += (strong && strong->IsClassSet("last") ? "|last;" : "|;");
+		}
+		return result;
+	};
+
+	CHECK(GetRows() == "");
+
+	// Every new row is instanced from the same parsed contents, each with its own bindings.
+	rows = {{1}, {2, 3}, {4, 5, 6}};
+	handle.DirtyVariable("rows");
+	CHECK(GetRows() == "|1|;1|23|;2|456|last;");
+
+	rows.resize(1);
+	rows.push_back({7, 8});
+	handle.DirtyVariable("rows");
+	CHECK(GetRows() == "|1|;1|78|last;");
+
+	rows.clear();
+	handle.DirtyVariable("rows");
+	CHECK(GetRows() == "");
+
+	document->Close();
+	context->RemoveDataModel("for");
+
+	TestsShell::ShutdownShell();
+}
+
+static const String for_key_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div data-model="for_key">
+<p data-for="item : items" data-key="item.id" class="item">{{ it_index }}:{{ item.name }}</p>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.for_key")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Item {
+		int id;
+		String name;
+	};
+	Vector<Item> items = {{1, "a"}, {2, "b"}, {3, "c"}};
+
+	DataModelConstructor constructor = context->CreateDataModel("for_key");
+	REQUIRE(constructor);
+	if (auto item_handle = constructor.RegisterStruct<Item>())
+	{
+		item_handle.RegisterMember("id", &Item::id);
+		item_handle.RegisterMember("name", &Item::name);
+	}
+	REQUIRE(constructor.RegisterArray<Vector<Item>>());
+	REQUIRE(constructor.Bind("items", &items));
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(for_key_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto GetItems = [&](ElementList& item_elements) {
+		context->Update();
+		item_elements.clear();
+		String result;
+		ElementList elements;
+		document->QuerySelectorAll(elements, ".item");
+		for (Element* element : elements)
+		{
+			if (element->HasAttribute("data-for"))
+				continue;
+			item_elements.push_back(element);
+			result += element->GetInnerRML() + ";";
+		}
+		return result;
+	};
+
+	ElementList before, after;
+	CHECK(GetItems(before) == "0:a;1:b;2:c;");
+
+	SUBCASE("Insert")
+	{
+		items.insert(items.begin(), Item{4, "d"});
+		handle.DirtyVariable("items");
+		CHECK(GetItems(after) == "0:d;1:a;2:b;3:c;");
+		REQUIRE(after.size() == 4);
+		CHECK(after[1] == before[0]);
+		CHECK(after[2] == before[1]);
+		CHECK(after[3] == before[2]);
+	}
+
+	SUBCASE("Reverse")
+	{
+		std::reverse(items.begin(), items.end());
+		handle.DirtyVariable("items");
+		CHECK(GetItems(after) == "0:c;1:b;2:a;");
+		REQUIRE(after.size() == 3);
+		CHECK(after[0] == before[2]);
+		CHECK(after[1] == before[1]);
+		CHECK(after[2] == before[0]);
+
+		// The moved elements are still bound to their items.
+		items[0].name = "e";
+		handle.DirtyVariable("items");
+		CHECK(GetItems(after) == "0:e;1:b;2:a;");
+		CHECK(after[0] == before[2]);
+	}
+
+	SUBCASE("Remove")
+	{
+		items.erase(items.begin() + 1);
+		items.push_back(Item{5, "f"});
+		handle.DirtyVariable("items");
+		CHECK(GetItems(after) == "0:a;1:c;2:f;");
+		REQUIRE(after.size() == 3);
+		CHECK(after[0] == before[0]);
+		CHECK(after[1] == before[2]);
+	}
+
+	document->Close();
+	context->RemoveDataModel("for_key");
+
+	TestsShell::ShutdownShell();
+}
+
+static const String for_virtual_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+		#list { height: 100px; overflow: auto; }
+		p { display: block; height: 20px; }
+	</style>
+</head>
+<body>
+<div id="list" data-model="for_virtual">
+<p data-for="items" data-virtual="20">{{ it_index }}:{{ it }}</p>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.for_virtual")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> items(1000);
+	for (int i = 0; i < (int)items.size(); i++)
+		items[i] = i * 10;
+
+	DataModelConstructor constructor = context->CreateDataModel("for_virtual");
+	REQUIRE(constructor);
+	REQUIRE(constructor.RegisterArray<Vector<int>>());
+	REQUIRE(constructor.Bind("items", &items));
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(for_virtual_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// The viewport size is only known after the first layout, the view then updates its range on the following updates.
+	for (int i = 0; i < 3; i++)
+		context->Update();
+
+	Element* list = document->GetElementById("list");
+
+	auto GetRows = [&]() {
+		ElementList rows;
+		list->GetElementsByTagName(rows, "p");
+		rows.erase(std::remove_if(rows.begin(), rows.end(), [](Element* row) { return row->HasAttribute("data-for"); }), rows.end());
+		return rows;
+	};
+
+	// Only the rows within the viewport and the overscan margin are instanced, while the full extent is reserved.
+	ElementList rows = GetRows();
+	CHECK(rows.size() < 20);
+	REQUIRE(!rows.empty());
+	CHECK(rows.front()->GetInnerRML() == "0:0");
+	CHECK(list->GetScrollHeight() == doctest::Approx(20.f * 1000.f));
+
+	list->SetScrollTop(5000.f);
+	context->Update();
+	context->Update();
+
+	// The viewport holds five rows, and four rows are added on each side.
+	ElementList scrolled_rows = GetRows();
+	CHECK(scrolled_rows.size() == 13);
+	REQUIRE(!scrolled_rows.empty());
+	CHECK(scrolled_rows.front()->GetInnerRML() == "246:2460");
+	CHECK(scrolled_rows.front()->GetAbsoluteOffset().y - list->GetAbsoluteOffset(Box::PADDING).y == doctest::Approx(-80.f));
+
+	// The elements are recycled as the list scrolls.
+	for (Element* row : rows)
+		CHECK(std::find(scrolled_rows.begin(), scrolled_rows.end(), row) != scrolled_rows.end());
+
+	// The view is only updated when a different range of rows comes into view.
+	list->SetScrollTop(5010.f);
+	context->Update();
+	list->SetScrollTop(5015.f);
+	CHECK(!handle.IsVariableDirty("items"));
+	context->Update();
+	CHECK(!handle.IsVariableDirty("items"));
+
+	items.resize(10);
+	handle.DirtyVariable("items");
+	for (int i = 0; i < 3; i++)
+		context->Update();
+
+	// The scroll offset is clamped to the end of the shrunk list, which brings the last rows back into view.
+	CHECK(list->GetScrollTop() == doctest::Approx(100.f));
+	CHECK(list->GetScrollHeight() == doctest::Approx(20.f * 10.f));
+	const ElementList shrunk_rows = GetRows();
+	CHECK(shrunk_rows.size() == 9);
+	REQUIRE(!shrunk_rows.empty());
+	CHECK(shrunk_rows.back()->GetInnerRML() == "9:90");
+
+	document->Close();
+	context->RemoveDataModel("for_virtual");
+
+	TestsShell::ShutdownShell();
+}
+
+static const String dirty_address_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div data-model="dirty_address">
+<p id="size">{{ members.size }}</p>
+<p data-for="member : members" class="member">{{ member.name }}:{{ member.health }}</p>
+<input id="checkbox" type="checkbox" data-checked="members[0].active"/>
+<p id="active" data-if="members[0].active">active</p>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.dirty_address")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	struct Member {
+		String name;
+		int health;
+		bool active;
+	};
+	Vector<Member> members = {{"a", 100, false}, {"b", 100, false}};
+
+	DataModelConstructor constructor = context->CreateDataModel("dirty_address");
+	REQUIRE(constructor);
+	if (auto member_handle = constructor.RegisterStruct<Member>())
+	{
+		member_handle.RegisterMember("name", &Member::name);
+		member_handle.RegisterMember("health", &Member::health);
+		member_handle.RegisterMember("active", &Member::active);
+	}
+	REQUIRE(constructor.RegisterArray<Vector<Member>>());
+	REQUIRE(constructor.Bind("members", &members));
+	DataModelHandle handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(dirty_address_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto GetMembers = [&]() {
+		context->Update();
+		String result;
+		ElementList elements;
+		document->QuerySelectorAll(elements, ".member");
+		for (Element* element : elements)
+		{
+			if (!element->HasAttribute("data-for"))
+				result += element->GetInnerRML() + ";";
+		}
+		return result;
+	};
+
+	CHECK(GetMembers() == "a:100;b:100;");
+
+	// Only the views depending on the dirty address are updated, the first member still shows its previous health.
+	members[0].health = 50;
+	members[1].health = 75;
+	handle.DirtyAddress("members[1].health");
+	CHECK(GetMembers() == "a:100;b:75;");
+
+	// Dirtying a containing address updates every view depending on a part of it.
+	handle.DirtyAddress("members[0]");
+	CHECK(GetMembers() == "a:50;b:75;");
+
+	members[0].name = "c";
+	members[1].name = "d";
+	handle.DirtyVariable("members");
+	CHECK(GetMembers() == "c:50;d:75;");
+
+	// Controllers dirty the whole variable they assign to.
+	Element* active = document->GetElementById("active");
+	REQUIRE(active);
+	context->Update();
+	CHECK(active->GetComputedValues().display == Style::Display::None);
+
+	members[1].health = 25;
+	document->GetElementById("checkbox")->Click();
+	context->Update();
+	CHECK(members[0].active);
+	CHECK(active->GetComputedValues().display != Style::Display::None);
+	CHECK(GetMembers() == "c:50;d:25;");
+
+	document->Close();
+	context->RemoveDataModel("dirty_address");
+
+	TestsShell::ShutdownShell();
+}
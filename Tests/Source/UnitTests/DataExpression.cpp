@@ -150,3 +150,64 @@ TEST_CASE("Data expressions")
 }
 
 
+
+TEST_CASE("Data expressions constant folding")
+{
+	auto NumInstructions = [](const String& expression) -> size_t {
+		DataParser parser(expression, interface);
+		if (!parser.Parse(false))
+		{
+			FAIL_CHECK("Could not parse expression: " << expression);
+			return 0;
+		}
+		return parser.ReleaseProgram().instructions.size();
+	};
+
+	CHECK(NumInstructions("5*(1+2)") == 1);
+	CHECK(NumInstructions("!!10 - 1 ? 'hello' : 'world'") == 1);
+	CHECK(NumInstructions("5.2 + 19 + 'px'") == 1);
+	CHECK(NumInstructions("'hello world' | to_upper") == 2);
+
+	CHECK(TestExpression("!!10 - 1 ? 'hello' : 'world' | to_upper") == "WORLD");
+	CHECK(TestExpression("5*(1+2) == 15 ? 3 < 2 : 'no'") == "0");
+}
+
+TEST_CASE("Data expressions variable slots")
+{
+	DataTypeRegister slots_type_register;
+	DataModel slots_model(slots_type_register.GetTransformFuncRegister());
+	DataExpressionInterface slots_interface(&slots_model, nullptr);
+
+	int value = 2;
+	Vector<int> list = {1, 2, 3};
+
+	DataModelConstructor constructor(&slots_model, &slots_type_register);
+	constructor.RegisterArray<Vector<int>>();
+	constructor.Bind("value", &value);
+	constructor.Bind("list", &list);
+
+	// Only the constant parts of the expression are folded.
+	{
+		DataParser parser("value + 2*3", slots_interface);
+		REQUIRE(parser.Parse(false));
+		CHECK(parser.ReleaseProgram().instructions.size() == 5);
+	}
+
+	DataExpression expression("value*10 + list[1]");
+	REQUIRE(expression.Parse(slots_interface, false));
+
+	Variant result;
+	REQUIRE(expression.Run(slots_interface, result));
+	CHECK(result.Get<int>() == 22);
+
+	// The top-level variables are resolved once, while their values and children are read on every run.
+	value = 3;
+	list = {4, 5};
+	REQUIRE(expression.Run(slots_interface, result));
+	CHECK(result.Get<int>() == 35);
+
+	int other = 0;
+	constructor.Bind("other", &other);
+	REQUIRE(expression.Run(slots_interface, result));
+	CHECK(result.Get<int>() == 35);
+}
@@ -0,0 +1,96 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include "../Common/TestsUtilities.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Factory.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_path = "/assets/demo.rml";
+
+TEST_CASE("documentcache.load")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	CHECK(!Factory::PreloadDocument(document_path));
+
+	ElementDocument* document = context->LoadDocument(document_path);
+	REQUIRE(document);
+	document->Show();
+
+	Factory::EnableDocumentCache(true);
+	CHECK(Factory::PreloadDocument(document_path));
+
+	// The template and inline style sheet should be applied just like when loading the document from its file.
+	ElementDocument* cached_documents[] = {context->LoadDocument(document_path), context->LoadDocument(document_path)};
+
+	for (ElementDocument* cached_document : cached_documents)
+	{
+		REQUIRE(cached_document);
+		cached_document->Show();
+	}
+
+	TestsShell::RenderLoop();
+
+	for (ElementDocument* cached_document : cached_documents)
+	{
+		CHECK(cached_document->GetTitle() == document->GetTitle());
+		CHECK(cached_document->GetSourceURL() == document->GetSourceURL());
+		TestsUtilities::CompareElements(document, cached_document);
+		cached_document->Close();
+	}
+
+	document->Close();
+
+	Factory::EnableDocumentCache(false);
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("documentcache.missing")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Factory::EnableDocumentCache(true);
+
+	// Documents which fail to load are not cached, and are reported every time.
+	TestsShell::SetNumExpectedWarnings(2);
+	CHECK(!context->LoadDocument("/assets/missing.rml"));
+	CHECK(!Factory::PreloadDocument("/assets/missing.rml"));
+
+	Factory::EnableDocumentCache(false);
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,263 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/DrawList.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/RenderInterface.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_draw_list_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			display: block;
+			width: 500px;
+			height: 500px;
+		}
+		div {
+			display: block;
+			height: 10px;
+			margin: 2px;
+			background-color: #f00;
+		}
+		#clip {
+			height: 20px;
+			overflow: hidden;
+		}
+		#transform {
+			transform: rotate(45deg);
+		}
+	</style>
+</head>
+<body>
+<div id="a"/><div/><div/><div/><div/>
+<div id="clip"><div/><div/><div/><div/></div>
+<div id="transform"/>
+<div/><div/>
+</body>
+</rml>
+)";
+
+class DrawListRenderInterface : public RenderInterface {
+public:
+	void RenderGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/,
+		const Vector2f& /*translation*/) override
+	{
+		num_render_geometry += 1;
+	}
+	void EnableScissorRegion(bool /*enable*/) override {}
+	void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+	void RenderDrawList(const DrawList& draw_list) override
+	{
+		num_render_draw_list += 1;
+		last_draw_list = draw_list;
+		RenderInterface::RenderDrawList(draw_list);
+	}
+
+	int num_render_geometry = 0;
+	int num_render_draw_list = 0;
+	DrawList last_draw_list;
+};
+
+TEST_CASE("draw_list")
+{
+	TestsShell::GetContext();
+
+	DrawListRenderInterface render_interface;
+	Context* context = Rml::CreateContext("draw_list", Vector2i(1000, 1000), &render_interface);
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_draw_list_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	context->Render();
+	const int num_immediate_calls = render_interface.num_render_geometry;
+	CHECK(num_immediate_calls > 10);
+	CHECK(render_interface.num_render_draw_list == 0);
+
+	context->EnableDrawListRendering(true);
+	CHECK(context->IsDrawListRenderingEnabled());
+
+	render_interface.num_render_geometry = 0;
+	context->Render();
+	CHECK(render_interface.num_render_draw_list == 1);
+
+	// Geometry before, inside, and after the clipped and transformed elements are split into separate batches.
+	const DrawList& draw_list = render_interface.last_draw_list;
+	REQUIRE(draw_list.commands.size() == 4);
+	CHECK(render_interface.num_render_geometry == 4);
+
+	CHECK(draw_list.commands[0].transform_index == -1);
+	CHECK(draw_list.commands[0].scissor_enabled == false);
+	CHECK(draw_list.commands[1].scissor_enabled == true);
+	CHECK(draw_list.commands[2].transform_index == 0);
+	CHECK(draw_list.transforms.size() == 1);
+	CHECK(draw_list.commands[3].transform_index == -1);
+	CHECK(draw_list.commands[3].scissor_enabled == false);
+
+	int num_indices = 0;
+	for (const DrawCommand& command : draw_list.commands)
+	{
+		CHECK(command.index_offset == num_indices);
+		num_indices += command.num_indices;
+		for (int i = 0; i < command.num_indices; i++)
+		{
+			const int index = draw_list.indices[command.index_offset + i];
+			CHECK((index >= 0 && index < command.num_vertices));
+		}
+	}
+	CHECK(num_indices == (int)draw_list.indices.size());
+
+	context->EnableDrawListRendering(false);
+	render_interface.num_render_geometry = 0;
+	context->Render();
+	CHECK(render_interface.num_render_geometry == num_immediate_calls);
+	CHECK(render_interface.num_render_draw_list == 1);
+
+	document->Close();
+	Rml::RemoveContext("draw_list");
+	Rml::ReleaseTextures(&render_interface);
+
+	TestsShell::ShutdownShell();
+}
+
+static bool DrawListsEqual(const DrawList& a, const DrawList& b)
+{
+	if (a.vertices.size() != b.vertices.size() || a.indices != b.indices || a.transforms != b.transforms || a.commands.size() != b.commands.size())
+		return false;
+
+	for (size_t i = 0; i < a.vertices.size(); i++)
+	{
+		Vertex va = a.vertices[i];
+		const Vertex& vb = b.vertices[i];
+		if (va.position != vb.position || va.tex_coord != vb.tex_coord || !(va.colour == vb.colour))
+			return false;
+	}
+
+	for (size_t i = 0; i < a.commands.size(); i++)
+	{
+		const DrawCommand& ca = a.commands[i];
+		const DrawCommand& cb = b.commands[i];
+		if (ca.texture != cb.texture || ca.vertex_offset != cb.vertex_offset || ca.num_vertices != cb.num_vertices ||
+			ca.index_offset != cb.index_offset || ca.num_indices != cb.num_indices || ca.transform_index != cb.transform_index ||
+			ca.scissor_enabled != cb.scissor_enabled || ca.scissor_origin != cb.scissor_origin || ca.scissor_dimensions != cb.scissor_dimensions)
+			return false;
+	}
+
+	return true;
+}
+
+TEST_CASE("draw_list.retained")
+{
+	TestsShell::GetContext();
+
+	DrawListRenderInterface render_interface;
+	Context* context = Rml::CreateContext("draw_list", Vector2i(1000, 1000), &render_interface);
+	REQUIRE(context);
+
+	context->EnableRetainedRendering(true);
+	CHECK(context->IsRetainedRenderingEnabled());
+	CHECK(context->IsDrawListRenderingEnabled());
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_draw_list_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto Render = [&]() -> DrawList {
+		context->Update();
+		context->Render();
+		return render_interface.last_draw_list;
+	};
+
+	// Renders the context from scratch, without any retained geometry.
+	auto RenderReference = [&]() -> DrawList {
+		context->EnableRetainedRendering(false);
+		DrawList draw_list = Render();
+		context->EnableRetainedRendering(true);
+		Render();
+		return draw_list;
+	};
+
+	const DrawList first = Render();
+	CHECK(first.commands.size() == 4);
+	CHECK(render_interface.num_render_draw_list == 1);
+
+	// Nothing has changed, the same draw list should be submitted again.
+	CHECK(DrawListsEqual(Render(), first));
+	CHECK(render_interface.num_render_draw_list == 2);
+
+	SUBCASE("Property")
+	{
+		document->GetElementById("a")->SetProperty("background-color", "#0f0");
+		const DrawList retained = Render();
+		CHECK(!DrawListsEqual(retained, first));
+		CHECK(DrawListsEqual(retained, RenderReference()));
+	}
+
+	SUBCASE("Scroll")
+	{
+		document->GetElementById("clip")->SetScrollTop(5.f);
+		const DrawList retained = Render();
+		CHECK(!DrawListsEqual(retained, first));
+		CHECK(DrawListsEqual(retained, RenderReference()));
+	}
+
+	SUBCASE("Layout")
+	{
+		document->GetElementById("a")->SetProperty("height", "30px");
+		const DrawList retained = Render();
+		CHECK(!DrawListsEqual(retained, first));
+		CHECK(DrawListsEqual(retained, RenderReference()));
+
+		document->GetElementById("a")->SetProperty("height", "10px");
+		CHECK(DrawListsEqual(Render(), first));
+	}
+
+	SUBCASE("Close")
+	{
+		document->Close();
+		document = nullptr;
+		const DrawList retained = Render();
+		CHECK(retained.commands.empty());
+	}
+
+	if (document)
+		document->Close();
+	Rml::RemoveContext("draw_list");
+	Rml::ReleaseTextures(&render_interface);
+
+	TestsShell::ShutdownShell();
+}
@@ -28,8 +28,10 @@
 
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/SystemInterface.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -85,3 +87,216 @@ TEST_CASE("elementstyle.inline_decorator_images")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_shared_style_rml = R"(
+<rml>
+<head>
+	<style>
+		body {
+			font-size: 10px;
+		}
+		div {
+			display: block;
+			height: 2em;
+		}
+		div.wide {
+			width: 30px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="a"/><div id="b"/><div id="c" style="height: 5px;"/><div id="d"/><div id="e" class="wide"/><div id="f"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.shared_computed_values")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_shared_style_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	auto Height = [&](const char* id) { return document->GetElementById(id)->GetComputedValues().height.value; };
+	auto Width = [&](const char* id) { return document->GetElementById(id)->GetComputedValues().width.type; };
+
+	CHECK(Height("a") == 20.f);
+	CHECK(Height("b") == 20.f);
+	CHECK(Height("c") == 5.f);
+	CHECK(Height("d") == 20.f);
+	CHECK(Height("f") == 20.f);
+	CHECK(Width("d") == Style::Width::Auto);
+	CHECK(Width("e") == Style::Width::Length);
+	CHECK(Width("f") == Style::Width::Auto);
+
+	// Siblings that are recomputed together must still pick up em-relative and inherited changes.
+	document->SetProperty("font-size", "20px");
+	document->SetProperty("color", "#0f0");
+	context->Update();
+
+	for (const char* id : {"a", "b", "d", "e", "f"})
+	{
+		CHECK(Height(id) == 40.f);
+		Colourb color = document->GetElementById(id)->GetComputedValues().inherited->color;
+		CHECK((color == Colourb(0, 255, 0)));
+	}
+	CHECK(Height("c") == 5.f);
+
+	// Changing the definition of a single row must not leak into its siblings.
+	document->GetElementById("b")->SetClass("wide", true);
+	document->GetElementById("e")->SetClass("wide", false);
+	context->Update();
+
+	CHECK(Width("a") == Style::Width::Auto);
+	CHECK(Width("b") == Style::Width::Length);
+	CHECK(Width("d") == Style::Width::Auto);
+	CHECK(Width("e") == Style::Width::Auto);
+	CHECK(Width("f") == Style::Width::Auto);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_value_groups_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 14px;
+			color: #fff;
+		}
+		.rotated {
+			transform: rotate(10deg);
+		}
+	</style>
+</head>
+
+<body>
+<div id="parent"><p id="plain">Plain</p><p id="colored" style="color: #f00;">Colored</p><p id="rotated" class="rotated">Rotated</p></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.computed_value_groups")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_value_groups_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	auto Values = [&](const char* id) -> const ComputedValues& { return document->GetElementById(id)->GetComputedValues(); };
+
+	// Inherited values are shared with the parent until any of them are set locally.
+	CHECK(Values("plain").inherited.IsSharedWith(Values("parent").inherited));
+	CHECK(!Values("colored").inherited.IsSharedWith(Values("parent").inherited));
+	CHECK(Colourb(255, 0, 0) == Values("colored").inherited->color);
+	CHECK(Values("colored").inherited->font_size == 14.f);
+
+	// Rarely used values are only copied by the elements which set them.
+	CHECK(Values("plain").rare.IsSharedWith(Values("colored").rare));
+	CHECK(!Values("rotated").rare.IsSharedWith(Values("plain").rare));
+	CHECK((Values("rotated").rare->transform != nullptr));
+	CHECK((Values("plain").rare->transform == nullptr));
+
+	// Changes to inherited values must reach the children sharing them.
+	document->SetProperty("font-size", "20px");
+	context->Update();
+
+	CHECK(Values("plain").inherited->font_size == 20.f);
+	CHECK(Values("colored").inherited->font_size == 20.f);
+	CHECK(Colourb(255, 0, 0) == Values("colored").inherited->color);
+	CHECK(Values("plain").inherited.IsSharedWith(Values("parent").inherited));
+
+	document->GetElementById("rotated")->SetClass("rotated", false);
+	context->Update();
+	CHECK((Values("rotated").rare->transform == nullptr));
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_animated_values_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 14px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="parent"><p id="child">Child</p><p id="opaque" style="opacity: 1;">Opaque</p></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.animated_values")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Step the time manually, so that the animations advance by the same amount on every run.
+	double time = GetSystemInterface()->GetElapsedTime();
+	TestsShell::SetTime(time);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_animated_values_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* parent = document->GetElementById("parent");
+	Element* child = document->GetElementById("child");
+	Element* opaque = document->GetElementById("opaque");
+
+	Property start_opacity(1.f, Property::NUMBER);
+	parent->Animate("opacity", Property(0.f, Property::NUMBER), 100.f, Tween{}, 1, true, 0.f, &start_opacity);
+	parent->Animate("transform", Transform::MakeProperty({Transforms::TranslateX(100.f)}), 100.f);
+	opaque->Animate("background-color", Property(Colourb(255, 0, 0), Property::COLOUR), 100.f);
+
+	for (int i = 0; i < 3; i++)
+	{
+		time += 1.0;
+		TestsShell::SetTime(time);
+		context->Update();
+	}
+
+	// Animated values are applied directly to the computed values, which must match the animated properties.
+	const float opacity = parent->GetComputedValues().inherited->opacity;
+	CHECK(opacity < 1.f);
+	CHECK(opacity == parent->GetProperty<float>("opacity"));
+	CHECK(child->GetComputedValues().inherited->opacity == opacity);
+	CHECK(child->GetComputedValues().inherited.IsSharedWith(parent->GetComputedValues().inherited));
+	CHECK(opaque->GetComputedValues().inherited->opacity == 1.f);
+	CHECK(opaque->GetProperty<Colourb>("background-color") == opaque->GetComputedValues().background_color);
+	CHECK(opaque->GetComputedValues().background_color.red > 0);
+
+	const TransformPtr transform = parent->GetComputedValues().rare->transform;
+	REQUIRE((transform != nullptr));
+	CHECK((transform == parent->GetProperty("transform")->Get<TransformPtr>()));
+	CHECK((child->GetComputedValues().rare->transform == nullptr));
+
+	// The values should be resolved as normal when the style is recomputed for other reasons.
+	parent->SetProperty("color", "#f00");
+	context->Update();
+	CHECK(parent->GetComputedValues().inherited->opacity < 1.f);
+	CHECK(child->GetComputedValues().inherited->opacity == parent->GetComputedValues().inherited->opacity);
+	CHECK((parent->GetComputedValues().rare->transform != nullptr));
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,233 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../../../Source/Core/WorkerPool.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/Geometry.h>
+#include <RmlUi/Core/RenderInterface.h>
+#include <RmlUi/Core/Texture.h>
+#include <doctest.h>
+#include <thread>
+
+using namespace Rml;
+
+class FontTextureRenderInterface : public RenderInterface {
+public:
+	void RenderGeometry(Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/,
+		const Vector2f& /*translation*/) override
+	{}
+	void EnableScissorRegion(bool /*enable*/) override {}
+	void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+	bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions) override
+	{
+		num_generate_texture += 1;
+		texture_handle = TextureHandle(num_generate_texture);
+
+		last_texture_empty = true;
+		for (int i = 0; i < source_dimensions.x * source_dimensions.y; i++)
+		{
+			if (source[i * 4 + 3] != 0)
+			{
+				last_texture_empty = false;
+				break;
+			}
+		}
+		return true;
+	}
+	void ReleaseTexture(TextureHandle /*texture*/) override { num_release_texture += 1; }
+
+	int num_generate_texture = 0;
+	int num_release_texture = 0;
+	bool last_texture_empty = false;
+};
+
+// Font textures are generated on the worker pool, publish them as is done during context updates.
+static void PublishFontTextures()
+{
+	WorkerPool::Wait();
+	WorkerPool::ProcessCompletedTasks();
+}
+
+TEST_CASE("font_engine.append_glyphs")
+{
+	TestsShell::GetContext();
+
+	FontTextureRenderInterface render_interface;
+	FontEngineInterface* font_interface = GetFontEngineInterface();
+	const FontFaceHandle handle = font_interface->GetFontFaceHandle("latolatin", Style::FontStyle::Normal, Style::FontWeight::Normal, 37);
+	REQUIRE(handle);
+
+	auto GenerateString = [&](const String& string) {
+		GeometryList geometry;
+		font_interface->GenerateString(handle, 0, string, Vector2f(0.f), Colourb(255), 1.f, geometry);
+		PublishFontTextures();
+		return geometry;
+	};
+	auto GetTexCoords = [](GeometryList& geometry) {
+		Vector<Vector2f> tex_coords;
+		for (Geometry& g : geometry)
+			for (const Vertex& vertex : g.GetVertices())
+				tex_coords.push_back(vertex.tex_coord);
+		return tex_coords;
+	};
+
+	// Glyphs are normally added while measuring the string during layout, before generating its geometry.
+	String ascii_characters;
+	for (char c = ' '; c <= '~'; c++)
+		ascii_characters += c;
+	CHECK(font_interface->GetStringWidth(handle, ascii_characters) > 0);
+
+	GeometryList hello_geometry = GenerateString("Hello");
+	Vector<const Texture*> hello_textures;
+	for (Geometry& g : hello_geometry)
+	{
+		hello_textures.push_back(g.GetTexture());
+		CHECK(g.GetTexture()->GetHandle(&render_interface) != 0);
+	}
+	REQUIRE(!hello_textures.empty());
+	CHECK(render_interface.num_generate_texture == (int)hello_textures.size());
+	render_interface.num_generate_texture = 0;
+
+	const int version = font_interface->GetVersion(handle);
+	const Vector<Vector2f> hello_tex_coords = GetTexCoords(hello_geometry);
+
+	SUBCASE("Append")
+	{
+		const String new_characters = u8"ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏ";
+		CHECK(font_interface->GetStringWidth(handle, new_characters) > 0);
+
+		GeometryList new_geometry = GenerateString(new_characters);
+		CHECK(GetTexCoords(new_geometry).size() == 4 * StringUtilities::LengthUTF8(new_characters));
+
+		// Existing geometry stays valid, so there is no need to generate it again.
+		CHECK(font_interface->GetVersion(handle) == version);
+		GeometryList hello_geometry_again = GenerateString("Hello");
+		REQUIRE(hello_geometry_again.size() >= hello_textures.size());
+		for (size_t i = 0; i < hello_textures.size(); i++)
+			CHECK(hello_geometry_again[i].GetTexture() == hello_textures[i]);
+		CHECK(GetTexCoords(hello_geometry_again) == hello_tex_coords);
+
+		// Only the textures receiving new glyphs are generated again, previous textures are released in the process.
+		int num_textures_with_new_glyphs = 0;
+		int num_previous_textures_with_new_glyphs = 0;
+		for (size_t i = 0; i < new_geometry.size(); i++)
+		{
+			if (new_geometry[i].GetVertices().empty())
+				continue;
+			num_textures_with_new_glyphs += 1;
+			if (i < hello_textures.size())
+				num_previous_textures_with_new_glyphs += 1;
+		}
+		for (Geometry& g : new_geometry)
+			CHECK(g.GetTexture()->GetHandle(&render_interface) != 0);
+		CHECK(render_interface.num_generate_texture == num_textures_with_new_glyphs);
+		CHECK(render_interface.num_release_texture == num_previous_textures_with_new_glyphs);
+	}
+
+	SUBCASE("Regenerate")
+	{
+		// When the number of glyphs more than doubles, the layers are generated from scratch, which requires new geometry.
+		const String new_characters = u8"ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÐÑÒÓÔÕÖØÙÚÛÜÝÞßàáâãäåæçèéêëìíîïðñòóôõöøùúûüýþÿ¡¢£¤¥¦§¨©ª«¬®¯°±²³´µ¶·¸¹º»¼½¾¿ĀāĂăĄąĆćĈĉĊċČčĎďĐđĒēĔĕĖėĘęĚěĜĝĞğĠġĢģĤĥĦħĨĩĪīĬĭĮįİıĲĳĴĵĶķĸĹĺĻļĽľĿŀŁłŃńŅņŇňŉŊŋŌōŎŏŐőŒœŔŕŖŗŘřŚśŜŝŞşŠšŢţŤťŦŧŨũŪūŬŭŮůŰűŲųŴŵŶŷŸŹźŻżŽž";
+		CHECK(font_interface->GetStringWidth(handle, new_characters) > 0);
+
+		GeometryList new_geometry = GenerateString(new_characters);
+		CHECK(GetTexCoords(new_geometry).size() == 4 * StringUtilities::LengthUTF8(new_characters));
+		CHECK(font_interface->GetVersion(handle) != version);
+	}
+
+	Rml::ReleaseTextures(&render_interface);
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_engine.background_textures")
+{
+	TestsShell::GetContext();
+
+	FontTextureRenderInterface render_interface;
+	FontEngineInterface* font_interface = GetFontEngineInterface();
+	const FontFaceHandle handle = font_interface->GetFontFaceHandle("latolatin", Style::FontStyle::Normal, Style::FontWeight::Normal, 29);
+	REQUIRE(handle);
+
+	const String string = "Hello";
+	CHECK(font_interface->GetStringWidth(handle, string) > 0);
+
+	GeometryList geometry;
+	font_interface->GenerateString(handle, 0, string, Vector2f(0.f), Colourb(255), 1.f, geometry);
+	REQUIRE(!geometry.empty());
+	const Texture* texture = geometry[0].GetTexture();
+	const int version = font_interface->GetVersion(handle);
+
+	// Until the texture is published, it is rendered as a transparent placeholder. Without worker threads, the texture is
+	// generated immediately instead.
+	CHECK(texture->GetHandle(&render_interface) != 0);
+	CHECK(render_interface.last_texture_empty == (WorkerPool::GetNumThreads() > 0));
+
+	// Publishing the texture does not require the geometry to be generated again.
+	PublishFontTextures();
+	CHECK(font_interface->GetVersion(handle) == version);
+	CHECK(geometry[0].GetTexture() == texture);
+
+	const int num_generate_texture = render_interface.num_generate_texture;
+	CHECK(texture->GetHandle(&render_interface) != 0);
+	CHECK(!render_interface.last_texture_empty);
+	CHECK(render_interface.num_generate_texture == num_generate_texture + (WorkerPool::GetNumThreads() > 0 ? 1 : 0));
+
+	Rml::ReleaseTextures(&render_interface);
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("worker_pool.no_threads")
+{
+	// Initialise RmlUi without any worker threads, all work should then be done on the calling thread.
+	Rml::SetNumWorkerThreads(0);
+	TestsShell::GetContext();
+	CHECK(WorkerPool::GetNumThreads() == 0);
+
+	const std::thread::id main_thread = std::this_thread::get_id();
+
+	bool task_on_main_thread = false;
+	bool completed = false;
+	WorkerPool::Submit([&]() { task_on_main_thread = (std::this_thread::get_id() == main_thread); }, [&]() { completed = true; });
+	CHECK(task_on_main_thread);
+	CHECK(completed);
+
+	int num_calls = 0;
+	int num_calls_off_main_thread = 0;
+	WorkerPool::ParallelFor(10, [&](int /*i*/) {
+		num_calls += 1;
+		if (std::this_thread::get_id() != main_thread)
+			num_calls_off_main_thread += 1;
+	});
+	CHECK(num_calls == 10);
+	CHECK(num_calls_off_main_thread == 0);
+
+	TestsShell::ShutdownShell();
+	Rml::SetNumWorkerThreads(-1);
+}
@@ -0,0 +1,102 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core/Types.h>
+#include "../../../Source/Core/Memory.h"
+#include <doctest.h>
+#include <stdint.h>
+
+using namespace Rml;
+
+TEST_CASE("frame_arena")
+{
+	FrameArena arena(256);
+
+	SUBCASE("no_active_arena")
+	{
+		CHECK(FrameArena::GetActive() == nullptr);
+
+		// Without an active arena, containers are allocated from the heap.
+		FrameVector<int> numbers = {1, 2, 3};
+		CHECK(numbers.get_allocator() == FrameAllocator<int>());
+	}
+
+	SUBCASE("scope")
+	{
+		{
+			FrameArenaScope scope(&arena);
+			CHECK(FrameArena::GetActive() == &arena);
+
+			// Outgrow the initial block.
+			FrameVector<double> numbers;
+			for (int i = 0; i < 1000; i++)
+				numbers.push_back(double(i));
+
+			CHECK(reinterpret_cast<uintptr_t>(numbers.data()) % alignof(double) == 0);
+			CHECK(numbers[999] == 999.0);
+
+			{
+				// Nested scopes of the same arena must not reset it.
+				FrameArenaScope nested_scope(&arena);
+				FrameVector<char> characters(3, 'a');
+			}
+			CHECK(numbers[0] == 0.0);
+		}
+		CHECK(FrameArena::GetActive() == nullptr);
+
+		// The blocks are now merged, subsequent frames should re-use the same memory.
+		void* first_allocation = nullptr;
+		{
+			FrameArenaScope scope(&arena);
+			FrameVector<int> numbers(1000);
+			first_allocation = numbers.data();
+		}
+		{
+			FrameArenaScope scope(&arena);
+			FrameVector<int> numbers(1000);
+			CHECK(numbers.data() == first_allocation);
+		}
+	}
+
+	SUBCASE("live_allocations_prevent_reset")
+	{
+		FrameArenaScope scope(&arena);
+		void* ptr = arena.Allocate(alignof(int), sizeof(int));
+
+		arena.Reset();
+		void* next = arena.Allocate(alignof(int), sizeof(int));
+		CHECK(next != ptr);
+
+		arena.Deallocate(next);
+		arena.Deallocate(ptr);
+
+		arena.Reset();
+		CHECK(arena.Allocate(alignof(int), sizeof(int)) == ptr);
+		arena.Deallocate(ptr);
+	}
+}
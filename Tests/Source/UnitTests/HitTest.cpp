@@ -0,0 +1,140 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_hit_test_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 300px;
+			height: 400px;
+		}
+		.cell {
+			float: left;
+			width: 20px;
+			height: 20px;
+			margin: 5px;
+		}
+		#overlay {
+			position: absolute;
+			left: 0;
+			top: 0;
+			width: 60px;
+			height: 60px;
+		}
+		#cell0 {
+			transform: translate(0px, 310px);
+		}
+	</style>
+</head>
+<body>
+<div id="grid"/>
+<div id="overlay"/>
+</body>
+</rml>
+)";
+
+static constexpr int num_cells_per_row = 10;
+static constexpr int num_cells = num_cells_per_row * num_cells_per_row;
+
+static Vector2f GetCellCenter(int index)
+{
+	return Vector2f(float(index % num_cells_per_row) * 30.f + 15.f, float(index / num_cells_per_row) * 30.f + 15.f);
+}
+
+TEST_CASE("context.hit_test")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_hit_test_rml);
+	REQUIRE(document);
+
+	Element* grid = document->GetElementById("grid");
+	String cells_rml;
+	for (int i = 0; i < num_cells; i++)
+		cells_rml += CreateString(32, "<div class=\"cell\" id=\"cell%d\"/>", i);
+	grid->SetInnerRML(cells_rml);
+
+	document->Show();
+	context->Update();
+	context->Render();
+
+	Element* overlay = document->GetElementById("overlay");
+
+	auto CheckCells = [&](Vector2f overlay_min, Vector2f overlay_max) {
+		for (int i = 1; i < num_cells; i++)
+		{
+			const Vector2f center = GetCellCenter(i);
+			const bool overlapped = (center.x >= overlay_min.x && center.x <= overlay_max.x && center.y >= overlay_min.y && center.y <= overlay_max.y);
+
+			Element* expected = overlapped ? overlay : document->GetElementById(CreateString(16, "cell%d", i));
+			Element* result = context->GetElementAtPoint(center);
+			CHECK_MESSAGE(result == expected, "Cell ", i, " hit ", result ? result->GetAddress() : String("nothing"));
+		}
+	};
+
+	CheckCells(Vector2f(0.f), Vector2f(60.f));
+
+	// Points between the cells hit their container.
+	CHECK(context->GetElementAtPoint(Vector2f(275.f, 275.f)) == grid);
+
+	// The transformed cell is hit at its transformed position only.
+	Element* cell0 = document->GetElementById("cell0");
+	CHECK(context->GetElementAtPoint(Vector2f(15.f, 325.f)) == cell0);
+	overlay->SetProperty("display", "none");
+	context->Update();
+	context->Render();
+	CHECK(context->GetElementAtPoint(GetCellCenter(0)) == grid);
+
+	// Moving elements must be reflected in the following lookups.
+	overlay->SetProperty("display", "block");
+	overlay->SetProperty("left", "150px");
+	overlay->SetProperty("top", "90px");
+	context->Update();
+	context->Render();
+	CheckCells(Vector2f(150.f, 90.f), Vector2f(210.f, 150.f));
+
+	overlay->SetProperty("pointer-events", "none");
+	context->Update();
+	CheckCells(Vector2f(-1.f), Vector2f(-1.f));
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
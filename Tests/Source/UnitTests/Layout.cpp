@@ -27,6 +27,7 @@
  */
 
 #include "../Common/TestsShell.h"
+#include "../../../Source/Core/LayoutEngine.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
@@ -139,3 +140,217 @@ TEST_CASE("Layout.Position.Relative")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_layout_boundary_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			width: 500px;
+			height: 300px;
+		}
+		#panel {
+			position: relative;
+			width: 200px;
+			height: 100px;
+			overflow: auto;
+		}
+		#popup {
+			position: absolute;
+			right: 10px;
+			top: 20px;
+		}
+	</style>
+</head>
+
+<body>
+<p>Before</p>
+<div id="panel"><p id="panel_text">Panel</p><p>After</p></div>
+<div id="popup"><span id="popup_text">Popup</span></div>
+<p id="after">After</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("Layout.Boundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_boundary_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* panel = document->GetElementById("panel");
+	Element* popup = document->GetElementById("popup");
+	CHECK(LayoutEngine::IsLayoutBoundary(panel));
+	CHECK(LayoutEngine::IsLayoutBoundary(popup));
+	CHECK(!LayoutEngine::IsLayoutBoundary(document->GetElementById("after")));
+
+	struct ElementLayout {
+		Vector2f offset, size;
+		float scroll_height;
+		bool operator==(const ElementLayout& other) const
+		{
+			return offset == other.offset && size == other.size && scroll_height == other.scroll_height;
+		}
+	};
+	auto GetLayout = [&]() {
+		Vector<ElementLayout> result;
+		Function<void(Element*)> Collect = [&](Element* element) {
+			result.push_back({element->GetAbsoluteOffset(Box::BORDER), element->GetBox().GetSize(Box::BORDER), element->GetScrollHeight()});
+			for (int i = 0; i < element->GetNumChildren(); i++)
+				Collect(element->GetChild(i));
+		};
+		Collect(document);
+		return result;
+	};
+
+	// Formats the document from scratch, for reference.
+	auto GetReferenceLayout = [&]() {
+		document->SetProperty("width", "500px");
+		context->Update();
+		return GetLayout();
+	};
+
+	const Vector<ElementLayout> initial_layout = GetLayout();
+	const float popup_left = popup->GetAbsoluteLeft();
+	const float after_top = document->GetElementById("after")->GetAbsoluteTop();
+
+	SUBCASE("Relative")
+	{
+		document->GetElementById("panel_text")->SetInnerRML("Some longer text in the panel, which wraps over multiple lines, and makes the panel scrollable. "
+			"The layout of the rest of the document is unaffected by the contents of the panel, since its size is fixed.");
+		context->Update();
+		const Vector<ElementLayout> layout = GetLayout();
+		CHECK(panel->GetScrollHeight() > panel->GetClientHeight());
+		CHECK(!(layout == initial_layout));
+		CHECK(layout == GetReferenceLayout());
+	}
+
+	SUBCASE("Absolute")
+	{
+		document->GetElementById("popup_text")->SetInnerRML("Some longer popup text");
+		context->Update();
+		const Vector<ElementLayout> layout = GetLayout();
+		CHECK(popup->GetAbsoluteLeft() < popup_left);
+		CHECK(layout == GetReferenceLayout());
+	}
+
+	SUBCASE("BoundaryProperty")
+	{
+		// Changing the size of the boundary itself affects its surroundings.
+		panel->SetProperty("height", "150px");
+		context->Update();
+		const Vector<ElementLayout> layout = GetLayout();
+		CHECK(document->GetElementById("after")->GetAbsoluteTop() == doctest::Approx(after_top + 50.f));
+		CHECK(layout == GetReferenceLayout());
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_layout_cache_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			width: 600px;
+			height: 400px;
+		}
+		.row { display: flex; flex-direction: row; }
+		.column { display: flex; flex-direction: column; }
+		.item { padding: 2px 4px; }
+		table { display: table; }
+		tr { display: table-row; }
+		td { display: table-cell; vertical-align: middle; }
+	</style>
+</head>
+
+<body>
+<div class="row">
+	<div class="item column">
+		<div class="item row"><span class="item">Menu</span><span class="item" id="text">%s</span></div>
+		<div class="item row"><div class="item column"><span>Nested</span><span>Entries</span></div></div>
+	</div>
+	<div class="item">
+		<table><tr><td>Cell</td><td><div class="row"><span class="item">Flex in cell</span></div></td></tr></table>
+	</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Layout.Cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	auto LoadDocument = [&](const char* text) {
+		ElementDocument* document = context->LoadDocumentFromMemory(CreateString(document_layout_cache_rml.size() + 64, document_layout_cache_rml.c_str(), text));
+		REQUIRE(document);
+		document->Show();
+		context->Update();
+		return document;
+	};
+
+	auto GetLayout = [&](ElementDocument* document) {
+		Vector<float> result;
+		Function<void(Element*)> Collect = [&](Element* element) {
+			const Vector2f offset = element->GetAbsoluteOffset(Box::BORDER);
+			const Vector2f size = element->GetBox().GetSize(Box::BORDER);
+			result.insert(result.end(), {offset.x, offset.y, size.x, size.y});
+			for (int i = 0; i < element->GetNumChildren(); i++)
+				Collect(element->GetChild(i));
+		};
+		Collect(document);
+		return result;
+	};
+
+	// Formats a new document with the given contents from scratch, for reference.
+	auto GetReferenceLayout = [&](const char* text) {
+		ElementDocument* reference_document = LoadDocument(text);
+		const Vector<float> layout = GetLayout(reference_document);
+		reference_document->Close();
+		context->Update();
+		return layout;
+	};
+
+	ElementDocument* document = LoadDocument("Short");
+	Element* text = document->GetElementById("text");
+	const Vector<float> initial_layout = GetLayout(document);
+
+	// Formatting the document again re-uses the measurements from the previous layout.
+	document->SetProperty("width", "600px");
+	context->Update();
+	CHECK(GetLayout(document) == initial_layout);
+
+	SUBCASE("Content")
+	{
+		text->SetInnerRML("Some much longer text");
+		context->Update();
+		const Vector<float> layout = GetLayout(document);
+		CHECK(layout != initial_layout);
+		CHECK(layout == GetReferenceLayout("Some much longer text"));
+	}
+
+	SUBCASE("Property")
+	{
+		text->SetProperty("font-size", "30px");
+		context->Update();
+		CHECK(GetLayout(document) != initial_layout);
+
+		text->RemoveProperty("font-size");
+		context->Update();
+		CHECK(GetLayout(document) == initial_layout);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,205 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../../../Source/Core/WorkerPool.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/SystemInterface.h>
+#include <doctest.h>
+#include <atomic>
+#include <thread>
+
+using namespace Rml;
+
+static const String document_parallel_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 14px;
+			width: 300px;
+			height: 200px;
+		}
+		#scroll {
+			overflow: auto;
+			height: 50px;
+		}
+		#animated {
+			animation: 0.2s move;
+		}
+		@keyframes move {
+			from { margin-left: 0px; }
+			to { margin-left: 50px; }
+		}
+	</style>
+</head>
+<body>
+<div id="scroll">
+	<p>Lorem ipsum dolor sit amet, consectetur adipiscing elit.</p>
+	<p>Sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.</p>
+	<p>Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris.</p>
+</div>
+<p id="animated">Animated</p>
+</body>
+</rml>
+)";
+
+class ThreadRecordingListener : public EventListener {
+public:
+	void ProcessEvent(Event& /*event*/) override
+	{
+		num_events += 1;
+		if (std::this_thread::get_id() != main_thread)
+			num_events_off_main_thread += 1;
+	}
+
+	std::thread::id main_thread = std::this_thread::get_id();
+	int num_events = 0;
+	int num_events_off_main_thread = 0;
+};
+
+static void CollectLayout(Element* element, Vector<Vector2f>& out_layout)
+{
+	out_layout.push_back(element->GetAbsoluteOffset());
+	out_layout.push_back(element->GetBox().GetSize());
+
+	for (int i = 0; i < element->GetNumChildren(true); i++)
+		CollectLayout(element->GetChild(i), out_layout);
+}
+
+TEST_CASE("worker_pool.parallel_for")
+{
+	TestsShell::GetContext();
+
+	const std::thread::id main_thread = std::this_thread::get_id();
+	constexpr int count = 100;
+
+	Vector<std::atomic<int>> calls(count);
+	std::atomic<int> num_tasks_off_main_thread = {0};
+
+	WorkerPool::ParallelFor(count, [&](int i) {
+		calls[i] += 1;
+
+		WorkerPool::RunOnCallingThread([&]() {
+			if (std::this_thread::get_id() != main_thread)
+				num_tasks_off_main_thread += 1;
+		});
+	});
+
+	for (const std::atomic<int>& num_calls : calls)
+		CHECK(num_calls == 1);
+
+	CHECK(num_tasks_off_main_thread == 0);
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.parallel_update")
+{
+	TestsShell::GetContext();
+
+	// Step the time manually, so that the animations are run to completion in a fixed number of updates.
+	double time = GetSystemInterface()->GetElapsedTime();
+	TestsShell::SetTime(time);
+
+	constexpr int num_documents = 8;
+
+	Context* contexts[2] = {
+		Rml::CreateContext("serial_update", Vector2i(1000, 1000)),
+		Rml::CreateContext("parallel_update", Vector2i(1000, 1000)),
+	};
+	REQUIRE(contexts[0]);
+	REQUIRE(contexts[1]);
+
+	CHECK(!contexts[0]->IsParallelUpdateEnabled());
+	contexts[1]->EnableParallelUpdate(true);
+	CHECK(contexts[1]->IsParallelUpdateEnabled());
+
+	ThreadRecordingListener listeners[2];
+
+	for (int i = 0; i < 2; i++)
+	{
+		for (int j = 0; j < num_documents; j++)
+		{
+			ElementDocument* document = contexts[i]->LoadDocumentFromMemory(document_parallel_rml);
+			REQUIRE(document);
+			document->GetElementById("animated")->AddEventListener(EventId::Animationend, &listeners[i]);
+			document->Show();
+		}
+	}
+
+	auto UpdateAll = [&]() {
+		for (Context* context : contexts)
+		{
+			context->Update();
+			context->Render();
+		}
+	};
+
+	UpdateAll();
+
+	// Modify every document, and let the animations run to completion.
+	for (int i = 0; i < 2; i++)
+	{
+		for (int j = 0; j < num_documents; j++)
+		{
+			ElementDocument* document = contexts[i]->GetDocument(j);
+			document->SetProperty(PropertyId::Width, Property(float(200 + 20 * j), Property::PX));
+			document->GetElementById("scroll")->SetInnerRML("<p>Short</p>");
+		}
+	}
+
+	for (int i = 0; i < 10; i++)
+	{
+		time += 0.05;
+		TestsShell::SetTime(time);
+		UpdateAll();
+	}
+
+	Vector<Vector2f> layouts[2];
+	for (int i = 0; i < 2; i++)
+		CollectLayout(contexts[i]->GetRootElement(), layouts[i]);
+
+	CHECK(layouts[0].size() > size_t(num_documents * 5));
+	CHECK(layouts[0] == layouts[1]);
+
+	// Event listeners are always called on the thread updating the context.
+	CHECK(listeners[0].num_events == num_documents);
+	CHECK(listeners[1].num_events == num_documents);
+	CHECK(listeners[1].num_events_off_main_thread == 0);
+
+	for (Context* context : contexts)
+		Rml::RemoveContext(context->GetName());
+
+	TestsShell::ShutdownShell();
+}
@@ -104,6 +104,11 @@ static const Vector<QuerySelector> query_selectors =
 	{ "span:empty",                  "Y D0 D1 F0" },
 	{ ".hello.world, #P span, #I",   "Z D0 D1 F0 I" },
 	{ "body * span",                 "D0 D1 F0" },
+	{ "div.parent p span",           "D0 D1 F0" },
+	{ "#P > p > span",               "D0 D1 F0" },
+	{ ".world span",                 "" },
+	{ "#Z *",                        "" },
+	{ "h3 span",                     "" },
 };
 struct ClosestSelector {
 	String start_id;
@@ -192,6 +197,35 @@ TEST_CASE("Selectors")
 		}
 	}
 
+	SUBCASE("RCSS document selectors with ancestor changes")
+	{
+		const String document_string = doc_begin + ".active p { drag: drag; } .active > h1 { drag: drag; }" + doc_end;
+		ElementDocument* document = context->LoadDocumentFromMemory(document_string);
+		REQUIRE(document);
+		context->Update();
+
+		String matching_ids;
+		GetMatchingIds(matching_ids, document);
+		CHECK(matching_ids == "");
+
+		document->GetElementById("P")->SetClass("active", true);
+		context->Update();
+
+		matching_ids.clear();
+		GetMatchingIds(matching_ids, document);
+		CHECK(matching_ids == "A B C D F G H ");
+
+		document->GetElementById("P")->SetClass("active", false);
+		document->SetClass("active", true);
+		context->Update();
+
+		matching_ids.clear();
+		GetMatchingIds(matching_ids, document);
+		CHECK(matching_ids == "B C D F G H ");
+
+		context->UnloadDocument(document);
+	}
+
 	SUBCASE("QuerySelector(All)")
 	{
 		const String document_string = doc_begin + doc_end;
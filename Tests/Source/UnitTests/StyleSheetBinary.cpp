@@ -0,0 +1,231 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "../Common/TestsShell.h"
+#include "../Common/TestsUtilities.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/StreamMemory.h>
+#include <RmlUi/Core/StyleSheetContainer.h>
+#include <RmlUi/Core/TransformPrimitive.h>
+#include <doctest.h>
+#include <stddef.h>
+
+using namespace Rml;
+
+static const String style_sheet_rcss = R"(
+@spritesheet theme {
+	src: /assets/invader.tga;
+	resolution: 2x;
+	icon: 128px 152px 51px 39px;
+}
+@decorator framed : tiled-horizontal {
+	left-image: icon;
+	center-image: icon;
+	right-image: icon;
+}
+@keyframes pulse {
+	from { opacity: 0.5; transform: scale(1.0); }
+	50% { background-color: #f00a; }
+	to { opacity: 1; transform: scale(1.5) rotate(45deg); }
+}
+body {
+	font-family: LatoLatin;
+	font-size: 16dp;
+	color: #333;
+	width: 50vw;
+}
+div {
+	display: block;
+	margin: 1em 2% 3px auto;
+	padding: 5px;
+	border: 2px #0f0;
+	transition: opacity background-color 0.5s cubic-in-out;
+}
+div.box > p:nth-child(2n+1) {
+	height: 20px;
+	decorator: framed, image(icon);
+	font-effect: outline(2px black);
+	transform: translateX(10px) perspective(100px) rotate3d(1, 0, 0, 30deg);
+	transform-origin: left top;
+}
+#first p:last-child:hover {
+	animation: 2s bounce-out 0.5s infinite alternate pulse;
+}
+@media (max-width: 1000px) {
+	div { padding: 10px; }
+}
+@media (min-width: 1000px) and (orientation: landscape) {
+	div { padding: 15px; }
+}
+)";
+
+static const String document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+</head>
+<body style="font-family: LatoLatin;">
+	<div id="first" class="box">
+		<p>One</p>
+		<p>Two</p>
+		<p>Three</p>
+	</div>
+	<div class="box window">
+		<handle><h1>Title</h1></handle>
+		<p>Four</p>
+		<button>Five</button>
+		<input type="text" value="Six"/>
+	</div>
+</body>
+</rml>
+)";
+
+static SharedPtr<StyleSheetContainer> LoadBinaryStyleSheet(const StyleSheetContainer& style_sheet, const String& source_url)
+{
+	StreamMemory binary;
+	REQUIRE(style_sheet.SaveStyleSheetContainer(&binary));
+
+	StreamMemory stream(binary.RawStream(), binary.Length());
+	stream.SetSourceURL(source_url);
+	return Factory::InstanceStyleSheetStream(&stream);
+}
+
+TEST_CASE("stylesheetbinary.round_trip")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const String source_url = "/assets/test.rcss";
+	StreamMemory text_stream((const byte*)style_sheet_rcss.data(), style_sheet_rcss.size());
+	text_stream.SetSourceURL(source_url);
+
+	SharedPtr<StyleSheetContainer> sheets[] = {
+		Factory::InstanceStyleSheetStream(&text_stream),
+		Factory::InstanceStyleSheetFile("/assets/invader.rcss"),
+	};
+
+	for (const SharedPtr<StyleSheetContainer>& text_sheet : sheets)
+	{
+		REQUIRE((text_sheet != nullptr));
+		SharedPtr<StyleSheetContainer> binary_sheet = LoadBinaryStyleSheet(*text_sheet, source_url);
+		REQUIRE((binary_sheet != nullptr));
+
+		ElementDocument* text_document = context->LoadDocumentFromMemory(document_rml);
+		ElementDocument* binary_document = context->LoadDocumentFromMemory(document_rml);
+		REQUIRE(text_document);
+		REQUIRE(binary_document);
+
+		text_document->SetStyleSheetContainer(text_sheet);
+		binary_document->SetStyleSheetContainer(binary_sheet);
+		text_document->Show();
+		binary_document->Show();
+
+		// Hover the last paragraph of both documents to start the animation declared in the pseudo class rule.
+		for (ElementDocument* document : {text_document, binary_document})
+			document->GetElementById("first")->GetLastChild()->SetPseudoClass("hover", true);
+
+		TestsShell::RenderLoop();
+
+		TestsUtilities::CompareElements(text_document, binary_document);
+
+		text_document->Close();
+		binary_document->Close();
+		context->Update();
+	}
+
+	// The style sheets hold on to their textures, release them before shutting down.
+	for (SharedPtr<StyleSheetContainer>& sheet : sheets)
+		sheet.reset();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("stylesheetbinary.invalid")
+{
+	TestsShell::GetContext();
+
+	StreamMemory text_stream((const byte*)style_sheet_rcss.data(), style_sheet_rcss.size());
+	SharedPtr<StyleSheetContainer> text_sheet = Factory::InstanceStyleSheetStream(&text_stream);
+	REQUIRE((text_sheet != nullptr));
+
+	StreamMemory binary;
+	REQUIRE(text_sheet->SaveStyleSheetContainer(&binary));
+
+	// A truncated file should be rejected with a warning, not be parsed as RCSS.
+	TestsShell::SetNumExpectedWarnings(1);
+	StreamMemory truncated(binary.RawStream(), binary.Length() / 2);
+	CHECK((Factory::InstanceStyleSheetStream(&truncated) == nullptr));
+
+	text_sheet.reset();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("stylesheetbinary.corrupt")
+{
+	TestsShell::GetContext();
+
+	const String rcss = "div { opacity: 0.5; transform: translateX(10px); }";
+	StreamMemory text_stream((const byte*)rcss.data(), rcss.size());
+	SharedPtr<StyleSheetContainer> text_sheet = Factory::InstanceStyleSheetStream(&text_stream);
+	REQUIRE((text_sheet != nullptr));
+
+	StreamMemory binary;
+	REQUIRE(text_sheet->SaveStyleSheetContainer(&binary));
+	const String data((const char*)binary.RawStream(), binary.Length());
+
+	// Replaces the byte at the given offset from the first occurence of the pattern, and checks that the result is rejected.
+	auto CheckCorrupt = [&](const String& pattern, size_t offset, char value) {
+		const size_t position = data.find(pattern);
+		REQUIRE(position != String::npos);
+
+		String corrupt = data;
+		corrupt[position + offset] = value;
+
+		TestsShell::SetNumExpectedWarnings(1);
+		StreamMemory stream((const byte*)corrupt.data(), corrupt.size());
+		CHECK((Factory::InstanceStyleSheetStream(&stream) == nullptr));
+		TestsShell::SetNumExpectedWarnings(0);
+	};
+
+	// The opacity is stored as its value type, the float 0.5, and the unit 'number'.
+	const String opacity = String("f\0\0\0\x3f\x08\0\0\0", 9);
+	// The transform is stored as its value type, a flag for non-empty transforms, the number of primitives, and the primitives.
+	const String transform = String("t\x01\x01\0\0\0", 6);
+
+	SUBCASE("library_version") { CheckCorrupt(Rml::GetVersion(), 0, '~'); }
+	SUBCASE("value_type") { CheckCorrupt(opacity, 0, 'p'); }
+	SUBCASE("unit") { CheckCorrupt(opacity, 5, '\x03'); }
+	SUBCASE("transform_primitive") { CheckCorrupt(transform, 6 + offsetof(TransformPrimitive, type), '\x7f'); }
+
+	TestsShell::ShutdownShell();
+}
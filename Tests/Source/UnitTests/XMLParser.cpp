@@ -0,0 +1,190 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/BaseXMLParser.h>
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/StreamMemory.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_rml = R"(<?xml version="1.0"?>
+<rml>
+<head>
+	<title>Test</title>
+	<style>
+		body { font-family: LatoLatin; }
+		div { display: block; padding: 5px; }
+	</style>
+</head>
+<!-- Comments are skipped. -->
+<body>
+	<div id="first" class='box'>
+		<p>One &amp; two</p>
+		<p title="&lt;three&gt;">Three</p>
+		<p data-attr=unquoted>Four<![CDATA[ <b>Five</b> ]]></p>
+	</div>
+	<div class="box window">
+		<handle><h1>Title</h1></handle>
+		<button>Six</button>
+		<input type="text" value="Seven"/>
+		<br/>
+	</div>
+</body>
+</rml>
+)";
+
+// Records the handler calls and line numbers of a parse.
+class RecordingParser : public BaseXMLParser {
+public:
+	void HandleElementStart(const String& name, const XMLAttributes& attributes) override
+	{
+		String record = "start " + name;
+		for (const auto& pair : attributes)
+			record += " " + pair.first + "=" + pair.second.Get<String>();
+		Record(record);
+	}
+	void HandleElementEnd(const String& name) override { Record("end " + name); }
+	void HandleData(const String& data, XMLDataType type) override { Record("data " + ToString((int)type) + " " + data); }
+
+	StringList records;
+
+private:
+	void Record(const String& record) { records.push_back(ToString(GetLineNumber()) + ":" + ToString(GetLineNumberOpenTag()) + " " + record); }
+};
+
+static String CompileDocument(const String& rml)
+{
+	StreamMemory text_stream((const byte*)rml.data(), rml.size());
+	StreamMemory compiled_stream;
+	REQUIRE(Factory::CompileDocumentStream(&text_stream, &compiled_stream));
+	return String((const char*)compiled_stream.RawStream(), compiled_stream.Length());
+}
+
+static StringList ParseRecords(const String& source)
+{
+	StreamMemory stream((const byte*)source.data(), source.size());
+	RecordingParser parser;
+	parser.RegisterCDATATag("script");
+	for (const String& name : Factory::GetStructuralDataViewAttributeNames())
+		parser.RegisterInnerXMLAttribute(name);
+	parser.Parse(&stream);
+	return parser.records;
+}
+
+static void CompareElements(Element* a, Element* b)
+{
+	REQUIRE(a->GetTagName() == b->GetTagName());
+	CHECK(a->GetId() == b->GetId());
+	CHECK(a->GetClassNames() == b->GetClassNames());
+	CHECK(a->GetNumAttributes() == b->GetNumAttributes());
+	CHECK(a->GetBox() == b->GetBox());
+	CHECK(a->GetAbsoluteOffset() == b->GetAbsoluteOffset());
+
+	REQUIRE(a->GetNumChildren(true) == b->GetNumChildren(true));
+	for (int i = 0; i < a->GetNumChildren(true); i++)
+		CompareElements(a->GetChild(i), b->GetChild(i));
+}
+
+TEST_CASE("xmlparser.compiled_handler_calls")
+{
+	TestsShell::GetContext();
+
+	const String compiled_rml = CompileDocument(document_rml);
+	const StringList text_records = ParseRecords(document_rml);
+	const StringList compiled_records = ParseRecords(compiled_rml);
+
+	REQUIRE(!text_records.empty());
+	CHECK(text_records == compiled_records);
+
+	// Compiling a compiled stream leaves it unchanged.
+	CHECK(CompileDocument(compiled_rml) == compiled_rml);
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("xmlparser.compiled_registrations")
+{
+	TestsShell::GetContext();
+
+	const String compiled_rml = CompileDocument(document_rml);
+
+	// With other registrations than at compile time the embedded source is parsed instead, giving the same result.
+	StreamMemory stream((const byte*)compiled_rml.data(), compiled_rml.size());
+	RecordingParser parser;
+	parser.RegisterCDATATag("p");
+	parser.Parse(&stream);
+
+	StreamMemory text_stream((const byte*)document_rml.data(), document_rml.size());
+	RecordingParser text_parser;
+	text_parser.RegisterCDATATag("p");
+	text_parser.Parse(&text_stream);
+
+	REQUIRE(!parser.records.empty());
+	CHECK(parser.records == text_parser.records);
+	CHECK(parser.records != ParseRecords(compiled_rml));
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("xmlparser.compiled_document")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const String compiled_rml = CompileDocument(document_rml);
+
+	ElementDocument* text_document = context->LoadDocumentFromMemory(document_rml);
+	ElementDocument* compiled_document = context->LoadDocumentFromMemory(compiled_rml);
+	REQUIRE(text_document);
+	REQUIRE(compiled_document);
+
+	text_document->Show();
+	compiled_document->Show();
+	TestsShell::RenderLoop();
+
+	CHECK(text_document->GetTitle() == compiled_document->GetTitle());
+	CHECK(text_document->GetInnerRML() == compiled_document->GetInnerRML());
+	CompareElements(text_document, compiled_document);
+
+	text_document->Close();
+	compiled_document->Close();
+
+	// A truncated compiled document should be rejected with a warning, without instancing any of its elements.
+	TestsShell::SetNumExpectedWarnings(1);
+	ElementDocument* truncated_document = context->LoadDocumentFromMemory(compiled_rml.substr(0, compiled_rml.size() - 10));
+	REQUIRE(truncated_document);
+	CHECK(truncated_document->GetNumChildren() == 0);
+	truncated_document->Close();
+
+	TestsShell::ShutdownShell();
+}
@@ -31,3 +31,4 @@
 
 #include "../Common/TestsInterface.cpp"
 #include "../Common/TestsShell.cpp"
+#include "../Common/TestsUtilities.cpp"
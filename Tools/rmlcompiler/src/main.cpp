@@ -0,0 +1,161 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core.h>
+#include <RmlUi/Core/StreamMemory.h>
+#include <RmlUi/Core/StyleSheetContainer.h>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+/*
+	Compiles RML documents and RCSS style sheets into their binary formats, which can be loaded in place of the source
+	without parsing. Inputs ending in '.rcss' are compiled as style sheets, anything else as RML.
+
+	Usage: rmlcompiler <input> <output> [<input> <output> ...]
+
+	The binary formats are tied to the version of RmlUi the compiler was built with. Custom properties, decorators, and
+	font effects must be registered before the style sheets are parsed. Applications which register their own should
+	instead call StyleSheetContainer::SaveStyleSheetContainer() after initialization. Compiled RML embeds its source,
+	which is parsed instead if the application registers different structural data views.
+ */
+
+class CompilerSystemInterface : public Rml::SystemInterface {
+public:
+	double GetElapsedTime() override
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+	}
+
+	bool LogMessage(Rml::Log::Type type, const Rml::String& message) override
+	{
+		if (type == Rml::Log::LT_ERROR || type == Rml::Log::LT_ASSERT)
+			num_errors++;
+		if (type <= Rml::Log::LT_WARNING)
+			fprintf(stderr, "%s\n", message.c_str());
+		return true;
+	}
+
+	int num_errors = 0;
+
+private:
+	std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+};
+
+static bool WriteFile(const char* output_path, Rml::StreamMemory& stream)
+{
+	FILE* file = fopen(output_path, "wb");
+	if (!file)
+	{
+		fprintf(stderr, "Could not open '%s' for writing.\n", output_path);
+		return false;
+	}
+
+	const bool result = (fwrite(stream.RawStream(), 1, stream.Length(), file) == stream.Length());
+	fclose(file);
+
+	if (!result)
+		fprintf(stderr, "Could not write '%s'.\n", output_path);
+
+	return result;
+}
+
+static bool CompileDocument(const char* input_path, const char* output_path)
+{
+	Rml::String source;
+	if (!Rml::GetFileInterface()->LoadFile(input_path, source))
+	{
+		fprintf(stderr, "Could not load document '%s'.\n", input_path);
+		return false;
+	}
+
+	Rml::StreamMemory input((const Rml::byte*)source.data(), source.size());
+	input.SetSourceURL(input_path);
+
+	Rml::StreamMemory stream;
+	if (!Rml::Factory::CompileDocumentStream(&input, &stream))
+	{
+		fprintf(stderr, "Could not compile document '%s'.\n", input_path);
+		return false;
+	}
+
+	return WriteFile(output_path, stream);
+}
+
+static bool CompileStyleSheet(const char* input_path, const char* output_path)
+{
+	Rml::SharedPtr<Rml::StyleSheetContainer> style_sheet = Rml::Factory::InstanceStyleSheetFile(input_path);
+	if (!style_sheet)
+	{
+		fprintf(stderr, "Could not load style sheet '%s'.\n", input_path);
+		return false;
+	}
+
+	Rml::StreamMemory stream;
+	if (!style_sheet->SaveStyleSheetContainer(&stream))
+	{
+		fprintf(stderr, "Could not compile style sheet '%s'.\n", input_path);
+		return false;
+	}
+
+	return WriteFile(output_path, stream);
+}
+
+static bool IsStyleSheetPath(const char* path)
+{
+	const size_t length = strlen(path);
+	return length >= 5 && strcmp(path + length - 5, ".rcss") == 0;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 3 || argc % 2 != 1)
+	{
+		fprintf(stderr, "Usage: %s <input> <output> [<input> <output> ...]\n", argv[0]);
+		return 1;
+	}
+
+	CompilerSystemInterface system_interface;
+	Rml::SetSystemInterface(&system_interface);
+
+	if (!Rml::Initialise())
+		return 1;
+
+	bool success = true;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		if (IsStyleSheetPath(argv[i]))
+			success &= CompileStyleSheet(argv[i], argv[i + 1]);
+		else
+			success &= CompileDocument(argv[i], argv[i + 1]);
+	}
+
+	Rml::Shutdown();
+
+	return (success && system_interface.num_errors == 0) ? 0 : 1;
+}